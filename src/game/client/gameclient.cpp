@@ -15,6 +15,7 @@
  */
 #include "gameclient.h"
 #include "anim2d.h"
+#include "audiomanager.h"
 #include "campaignmanager.h"
 #include "challengegenerals.h"
 #include "commandxlat.h"
@@ -57,6 +58,7 @@
 #include "w3ddisplay.h"
 #include "windowlayout.h"
 #include "windowxlat.h"
+#include <set>
 
 #ifdef GAME_DLL
 #include "hooker.h"
@@ -685,9 +687,16 @@ void GameClient::Allocate_Shadows()
 
 void GameClient::Preload_Assets(TimeOfDayType tod)
 {
+#ifndef GAME_DLL
+    std::set<const ThingTemplate *> audio_templates;
+#endif
+
     // TODO memory debug logging
     for (Drawable *draw = Get_Drawable_List(); draw != nullptr; draw = draw->Get_Next()) {
         draw->Preload_Assets(tod);
+#ifndef GAME_DLL
+        audio_templates.insert(draw->Get_Template());
+#endif
     }
 
     for (ThingTemplate *thing = g_theThingFactory->First_Template(); thing != nullptr;
@@ -699,9 +708,28 @@ void GameClient::Preload_Assets(TimeOfDayType tod)
                 draw->Preload_Assets(tod);
                 g_theGameClient->Destroy_Drawable(draw);
             }
+#ifndef GAME_DLL
+            audio_templates.insert(thing);
+#endif
         }
     }
 
+#ifndef GAME_DLL
+    // Decode the sounds the map's objects can make now rather than the first time each one plays mid game. Stop once
+    // the cache is full so later sounds don't push out the ones prefetched before them.
+    bool audio_cache_full = false;
+
+    for (auto it = audio_templates.begin(); it != audio_templates.end() && !audio_cache_full; ++it) {
+        for (int i = 0; i < THING_SOUNDCOUNT && !audio_cache_full; ++i) {
+            const Utf8String &event = (*it)->Get_Audio(static_cast<ThingTemplateAudioType>(i))->Get_Event_Name();
+
+            if (event.Is_Not_Empty()) {
+                audio_cache_full = !g_theAudio->Prefetch_Audio_Event(event);
+            }
+        }
+    }
+#endif
+
     for (unsigned int i = 0; i < g_debrisModelNamesGlobalHack.size(); i++) {
         g_theDisplay->Preload_Model_Assets(g_debrisModelNamesGlobalHack[i]);
     }
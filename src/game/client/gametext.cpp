@@ -57,6 +57,101 @@ GameTextInterface *GameTextManager::Create_Game_Text_Interface()
     return new GameTextManager;
 }
 
+#ifndef GAME_DLL
+namespace
+{
+// Case insensitive so lookups match strcasecmp in Compare_LUT.
+size_t Hash_Label(const char *label)
+{
+    size_t hash = 0;
+
+    for (; *label != '\0'; ++label) {
+        hash = tolower(static_cast<unsigned char>(*label)) + 5 * hash;
+    }
+
+    return hash;
+}
+} // namespace
+
+// Build a power of two open addressing table over the string infos, kept at most half full.
+void GameTextManager::Build_Label_Index(std::vector<StringInfo *> &index, StringInfo *info, int count)
+{
+    size_t size = 16;
+
+    while (size < static_cast<size_t>(count) * 2) {
+        size <<= 1;
+    }
+
+    index.assign(size, nullptr);
+
+    for (int i = 0; i < count; ++i) {
+        size_t slot = Hash_Label(info[i].label.Str()) & (size - 1);
+
+        while (index[slot] != nullptr) {
+            // Keep the first of any duplicate labels.
+            if (strcasecmp(index[slot]->label.Str(), info[i].label.Str()) == 0) {
+                break;
+            }
+
+            slot = (slot + 1) & (size - 1);
+        }
+
+        if (index[slot] == nullptr) {
+            index[slot] = &info[i];
+        }
+    }
+}
+
+// Find the string info for a label in a table built by Build_Label_Index.
+StringInfo *GameTextManager::Find_Label(const std::vector<StringInfo *> &index, const char *label)
+{
+    if (index.empty()) {
+        return nullptr;
+    }
+
+    size_t mask = index.size() - 1;
+
+    for (size_t slot = Hash_Label(label) & mask; index[slot] != nullptr; slot = (slot + 1) & mask) {
+        if (strcasecmp(index[slot]->label.Str(), label) == 0) {
+            return index[slot];
+        }
+    }
+
+    return nullptr;
+}
+#endif
+
+// Read a little endian 32bit value from CSF data, advancing the position.
+template<typename T> static bool Read_CSF_Value(const uint8_t *&pos, const uint8_t *end, T &value)
+{
+    static_assert(sizeof(T) == sizeof(uint32_t), "CSF fields are 32bit.");
+    uint32_t tmp;
+
+    if (end - pos < static_cast<ptrdiff_t>(sizeof(tmp))) {
+        return false;
+    }
+
+    memcpy(&tmp, pos, sizeof(tmp));
+    value = static_cast<T>(le32toh(tmp));
+    pos += sizeof(tmp);
+
+    return true;
+}
+
+// Copy a length prefixed narrow string from CSF data into a null terminated buffer, advancing the position.
+static bool Read_CSF_Chars(const uint8_t *&pos, const uint8_t *end, char *buffer, int32_t length, int buffer_len)
+{
+    if (length < 0 || length >= buffer_len || end - pos < length) {
+        return false;
+    }
+
+    memcpy(buffer, pos, length);
+    buffer[length] = '\0';
+    pos += length;
+
+    return true;
+}
+
 // Get a char from a file.
 char GameTextManager::Read_Char(File *file)
 {
@@ -347,7 +442,7 @@ void GameTextManager::Reverse_Word(char *start, char *end)
 // Get the count of strings in a str file.
 bool GameTextManager::Get_String_Count(const char *filename, int &count)
 {
-    File *file = g_theFileSystem->Open_File(filename, File::TEXT | File::READ);
+    File *file = g_theFileSystem->Open_File(filename, File::TEXT | File::READ | File::BUFFERED);
     count = 0;
 
     if (file == nullptr) {
@@ -403,7 +498,7 @@ bool GameTextManager::Get_CSF_Info(const char *filename)
 bool GameTextManager::Parse_String_File(const char *filename)
 {
     captainslog_info("Parsing string file '%s'.", filename);
-    File *file = g_theFileSystem->Open_File(filename, File::TEXT | File::READ);
+    File *file = g_theFileSystem->Open_File(filename, File::TEXT | File::READ | File::BUFFERED);
 
     if (file == nullptr) {
         return false;
@@ -488,102 +583,110 @@ bool GameTextManager::Parse_String_File(const char *filename)
 bool GameTextManager::Parse_CSF_File(const char *filename)
 {
     captainslog_info("Parsing CSF file '%s'.", filename);
-    CSFHeader header;
     File *file = g_theFileSystem->Open_File(filename, File::BINARY | File::READ);
 
-    if (file == nullptr || file->Read(&header, sizeof(header)) != sizeof(header)) {
+    if (file == nullptr) {
         return false;
     }
 
-    uint32_t id;
-    int index = 0;
+    int size = file->Size();
 
-    if (file->Read(&id, sizeof(id)) != sizeof(id)) {
+    if (size < static_cast<int>(sizeof(CSFHeader))) {
         file->Close();
 
         return false;
     }
 
+    // Decode from a single in memory copy of the file rather than issuing several small reads per entry.
+    uint8_t *data = static_cast<uint8_t *>(file->Read_Entire_And_Close());
+
+    if (data == nullptr) {
+        return false;
+    }
+
+    const uint8_t *pos = data + sizeof(CSFHeader);
+    const uint8_t *end = data + size;
+    uint32_t id;
+    int index = 0;
+    bool success = true;
+
     // Little endian "LBL " FourCC
-    while (id == FourCC<' ', 'L', 'B', 'L'>::value) {
+    while (index < m_textCount && Read_CSF_Value(pos, end, id) && id == FourCC<' ', 'L', 'B', 'L'>::value) {
         int32_t num_strings;
         int32_t length;
 
-        file->Read(&num_strings, sizeof(num_strings));
-        file->Read(&length, sizeof(length));
-
-        // convert to host endianess
-        length = le32toh(length);
-        num_strings = le32toh(num_strings);
-
-        if (length > 0) {
-            file->Read(m_bufferIn, length);
+        if (!Read_CSF_Value(pos, end, num_strings) || !Read_CSF_Value(pos, end, length)
+            || !Read_CSF_Chars(pos, end, m_bufferIn, length, sizeof(m_bufferIn))) {
+            success = false;
+            break;
         }
 
-        m_bufferIn[length] = '\0';
         m_stringInfo[index].label = m_bufferIn;
         m_maxLabelLen = std::max(length, m_maxLabelLen);
 
         // Read all strings associated with this label, Nox used multiple strings for
         // random variation, Generals only cares about first one.
-        for (int i = 0; i < num_strings; ++i) {
-            file->Read(&id, sizeof(id));
-
-            if (id != FourCC<' ', 'R', 'T', 'S'>::value && id != FourCC<'W', 'R', 'T', 'S'>::value) {
-                file->Close();
-
-                return false;
-            }
-
-            file->Read(&length, sizeof(length));
-            length = le32toh(length);
-
-            if (length > 0) {
-                file->Read(m_translateBuffer, sizeof(m_translateBuffer[0]) * length);
+        for (int i = 0; i < num_strings && success; ++i) {
+            if (!Read_CSF_Value(pos, end, id)
+                || (id != FourCC<' ', 'R', 'T', 'S'>::value && id != FourCC<'W', 'R', 'T', 'S'>::value)
+                || !Read_CSF_Value(pos, end, length) || length < 0 || length >= ARRAY_SIZE(m_translateBuffer)
+                || end - pos < length * 2) {
+                success = false;
+                break;
             }
 
             // CSF format supports multiple strings per label, but we only care about
             // first string.
             if (i == 0) {
-                m_translateBuffer[length] = '\0';
+                int j;
+
+                for (j = 0; j < length; ++j) {
+                    uint16_t encoded;
+                    memcpy(&encoded, pos + j * 2, sizeof(encoded));
 
-                for (int j = 0; m_translateBuffer[j] != '\0'; ++j) {
-                    // Correct for big endian systems
-                    m_translateBuffer[j] = le16toh(m_translateBuffer[j]);
+                    if (encoded == 0) {
+                        break;
+                    }
 
-                    // Binary NOT to decode
-                    m_translateBuffer[j] = ~m_translateBuffer[j];
+                    // Correct for big endian systems and binary NOT to decode
+                    m_translateBuffer[j] = ~le16toh(encoded);
                 }
 
+                m_translateBuffer[j] = '\0';
                 Strip_Spaces(m_translateBuffer);
                 m_stringInfo[index].text = m_translateBuffer;
             }
 
+            pos += length * 2;
+
             // FourCC of 'STRW' rather than 'STR ' indicates extra data.
             if (id == FourCC<'W', 'R', 'T', 'S'>::value) {
-                file->Read(&length, sizeof(length));
-                length = le32toh(length);
-
-                if (length > 0) {
-                    file->Read(m_bufferIn, length);
+                if (!Read_CSF_Value(pos, end, length)
+                    || !Read_CSF_Chars(pos, end, m_bufferIn, length, sizeof(m_bufferIn))) {
+                    success = false;
+                    break;
                 }
 
-                m_bufferIn[length] = '\0';
-
                 if (i == 0) {
                     m_stringInfo[index].speech = m_bufferIn;
                 }
             }
         }
 
-        ++index;
-
-        if (file->Read(&id, sizeof(id)) != sizeof(id)) {
+        if (!success) {
             break;
         }
+
+        ++index;
     }
 
-    file->Close();
+    delete[] data;
+
+    // A truncated or corrupt entry only drops itself and anything after it, the labels read so far are still usable.
+    if (!success) {
+        captainslog_warn("CSF file '%s' is corrupt after %d of %d labels.", filename, index, m_textCount);
+        m_stringInfo[index] = StringInfo();
+    }
 
     return true;
 }
@@ -592,7 +695,7 @@ bool GameTextManager::Parse_CSF_File(const char *filename)
 bool GameTextManager::Parse_Map_String_File(const char *filename)
 {
     captainslog_info("Parsing map string file '%s'.", filename);
-    File *file = g_theFileSystem->Open_File(filename, File::TEXT | File::READ);
+    File *file = g_theFileSystem->Open_File(filename, File::TEXT | File::READ | File::BUFFERED);
 
     if (file == nullptr) {
         return false;
@@ -762,6 +865,9 @@ void GameTextManager::Init()
     }
 
     qsort(m_stringLUT, m_textCount, sizeof(StringLookUp), Compare_LUT);
+#ifndef GAME_DLL
+    Build_Label_Index(m_stringIndex, m_stringInfo, m_textCount);
+#endif
 
     // Fetch the GUI window title string and set it here.
     Utf8String ntitle;
@@ -797,6 +903,10 @@ void GameTextManager::Reset()
         delete[] m_mapStringLUT;
         m_mapStringLUT = nullptr;
     }
+
+#ifndef GAME_DLL
+    m_mapStringIndex.clear();
+#endif
 }
 
 // Find and return the unicode string corresponding to the label provided.
@@ -818,6 +928,7 @@ Utf16String GameTextManager::Fetch(const char *args, bool *success)
         return m_failed;
     }
 
+#ifdef GAME_DLL
     Utf8String argstr = args;
     StringLookUp key = { &argstr, nullptr };
 
@@ -844,23 +955,52 @@ Utf16String GameTextManager::Fetch(const char *args, bool *success)
             return found->info->text;
         }
     }
+#else
+    // Hashed lookup doesn't need to build a temporary string for the label.
+    StringInfo *info = Find_Label(m_stringIndex, args);
+
+    if (info == nullptr && m_mapTextCount > 0) {
+        info = Find_Label(m_mapStringIndex, args);
+    }
+
+    if (info != nullptr) {
+        if (success != nullptr) {
+            *success = true;
+        }
+
+        return info->text;
+    }
+#endif
 
     if (success != nullptr) {
         *success = false;
     }
 
+#ifndef GAME_DLL
+    Utf8String label = args;
+    auto cached = m_noStringIndex.find(label);
+
+    if (cached != m_noStringIndex.end()) {
+        return cached->second->text;
+    }
+#endif
+
     // If we reached here, we didn't find a string from our string file.
     Utf16String missing;
     NoString *no_string;
 
     missing.Format(U_CHAR("MISSING: '%hs'"), args);
 
+#ifdef GAME_DLL
     // Find missing string in NoString list if it already exists.
     for (no_string = m_noStringList; no_string != nullptr; no_string = no_string->next) {
         if (missing == no_string->text) {
             break;
         }
     }
+#else
+    no_string = nullptr;
+#endif
 
     // If it was not found or the list was empty, add a new one.
     if (no_string == nullptr) {
@@ -868,6 +1008,9 @@ Utf16String GameTextManager::Fetch(const char *args, bool *success)
         no_string->text = missing;
         no_string->next = m_noStringList;
         m_noStringList = no_string;
+#ifndef GAME_DLL
+        m_noStringIndex[label] = no_string;
+#endif
     }
 
     return no_string->text;
@@ -921,6 +1064,9 @@ void GameTextManager::Init_Map_String_File(Utf8String const &filename)
     }
 
     qsort(m_mapStringLUT, m_mapTextCount, sizeof(StringLookUp), Compare_LUT);
+#ifndef GAME_DLL
+    Build_Label_Index(m_mapStringIndex, m_mapStringInfo, m_mapTextCount);
+#endif
 }
 
 // Destroys the main string file, doesn't affect loaded map strings.
@@ -946,5 +1092,9 @@ void GameTextManager::Deinit()
     }
 
     m_noStringList = nullptr;
+#ifndef GAME_DLL
+    m_stringIndex.clear();
+    m_noStringIndex.clear();
+#endif
     m_initialized = false;
 }
@@ -17,8 +17,18 @@
 #include "always.h"
 #include "asciistring.h"
 #include "file.h"
+#include "rtsutils.h"
 #include "subsysteminterface.h"
 #include "unicodestring.h"
+#include <vector>
+
+#ifndef GAME_DLL
+#ifdef THYME_USE_STLPORT
+#include <hash_map>
+#else
+#include <unordered_map>
+#endif
+#endif
 
 // This enum applies to RA2/YR and Generals/ZH, BFME ID's are slightly different.
 enum class LanguageID : int32_t
@@ -112,6 +122,10 @@ private:
     bool Parse_String_File(const char *filename);
     bool Parse_CSF_File(const char *filename);
     bool Parse_Map_String_File(const char *filename);
+#ifndef GAME_DLL
+    static void Build_Label_Index(std::vector<StringInfo *> &index, StringInfo *info, int count);
+    static StringInfo *Find_Label(const std::vector<StringInfo *> &index, const char *label);
+#endif
 
 private:
     int m_textCount;
@@ -133,6 +147,16 @@ private:
     StringLookUp *m_mapStringLUT;
     int m_mapTextCount;
     std::vector<Utf8String> m_stringVector;
+#ifndef GAME_DLL
+    // Open addressing tables over the string infos, looked up case insensitively like the sorted LUTs.
+    std::vector<StringInfo *> m_stringIndex;
+    std::vector<StringInfo *> m_mapStringIndex;
+#ifdef THYME_USE_STLPORT
+    std::hash_map<Utf8String, NoString *, rts::hash<Utf8String>, std::equal_to<Utf8String>> m_noStringIndex;
+#else
+    std::unordered_map<Utf8String, NoString *, rts::hash<Utf8String>, std::equal_to<Utf8String>> m_noStringIndex;
+#endif
+#endif
 };
 
 #ifdef GAME_DLL
@@ -348,6 +348,41 @@ void AudioEventRTS::Generate_Play_Info()
     m_isLogical = false;
 }
 
+/**
+ * Generates the filenames of all the sounds, attacks and decays the event could play. Music and speech are streamed so
+ * don't produce any.
+ */
+void AudioEventRTS::Generate_All_Sample_Filenames(std::vector<Utf8String> &filenames)
+{
+    if (m_eventInfo == nullptr) {
+        return;
+    }
+
+    AudioType type = m_eventInfo->Get_Event_Type();
+
+    if (type == EVENT_MUSIC || type == EVENT_SPEECH) {
+        return;
+    }
+
+    Utf8String prefix = Generate_Filename_Prefix(type, false);
+    Utf8String ext = Generate_Filename_Extension(type);
+
+    for (unsigned i = 0; i < m_eventInfo->Sound_Count(); ++i) {
+        filenames.push_back(prefix + m_eventInfo->Get_Sound(i) + ext);
+        Adjust_For_Localization(filenames.back());
+    }
+
+    for (unsigned i = 0; i < m_eventInfo->Attack_Count(); ++i) {
+        filenames.push_back(prefix + m_eventInfo->Get_Attack(i) + ext);
+        Adjust_For_Localization(filenames.back());
+    }
+
+    for (unsigned i = 0; i < m_eventInfo->Decay_Count(); ++i) {
+        filenames.push_back(prefix + m_eventInfo->Get_Decay(i) + ext);
+        Adjust_For_Localization(filenames.back());
+    }
+}
+
 /**
  * Decrements the events loop count.
  *
@@ -38,6 +38,8 @@ public:
     void Generate_Play_Info();
     void Decrease_Loop_Count();
     void Advance_Next_Play_Portion();
+    // Thyme specific: Every sample file the event could pick when played, used to warm the audio cache.
+    void Generate_All_Sample_Filenames(std::vector<Utf8String> &filenames);
 
     void Set_Event_Name(Utf8String name);
     void Set_Playing_Handle(int handle) { m_playingHandle = handle; }
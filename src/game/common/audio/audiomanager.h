@@ -173,6 +173,9 @@ public:
     virtual void Process_Playing_List() = 0;
     virtual void Process_Fading_List() = 0;
     virtual void Process_Stopped_List() = 0;
+#ifndef GAME_DLL
+    virtual bool Prefetch_Audio_Event(Utf8String event) { return true; }
+#endif
 
     AudioSettings *Get_Audio_Settings() const { return m_audioSettings; }
     MiscAudio *Get_Misc_Audio() const { return m_miscAudio; }
@@ -145,6 +145,9 @@ void TeamFactory::Clear()
 {
     std::map<NameKeyType, TeamPrototype *> temp(m_prototypes);
     m_prototypes.clear();
+#ifndef GAME_DLL
+    m_prototypesByID.clear();
+#endif
 
     for (std::map<NameKeyType, TeamPrototype *>::iterator it = temp.begin(); it != temp.end(); ++it) {
         it->second->Delete_Instance();
@@ -192,6 +195,9 @@ void TeamFactory::Add_Team_Prototype_To_List(TeamPrototype *team)
             it->second == team, "TeamFactory::Add_Team_Prototype_To_List: Team %s already exists... skipping.", name.Str());
     } else {
         m_prototypes[key] = team;
+#ifndef GAME_DLL
+        m_prototypesByID[team->Get_ID()] = team;
+#endif
     }
 }
 
@@ -204,6 +210,14 @@ void TeamFactory::Remove_Team_Prototype_From_List(TeamPrototype *team)
     if (it != m_prototypes.end()) {
         m_prototypes.erase(it);
     }
+
+#ifndef GAME_DLL
+    auto id_it = m_prototypesByID.find(team->Get_ID());
+
+    if (id_it != m_prototypesByID.end() && id_it->second == team) {
+        m_prototypesByID.erase(id_it);
+    }
+#endif
 }
 
 TeamPrototype *TeamFactory::Find_Team_Prototype(const Utf8String &name)
@@ -220,6 +234,15 @@ TeamPrototype *TeamFactory::Find_Team_Prototype(const Utf8String &name)
 
 TeamPrototype *TeamFactory::Find_Team_Prototype_By_ID(unsigned int id)
 {
+#ifndef GAME_DLL
+    auto id_it = m_prototypesByID.find(id);
+
+    if (id_it != m_prototypesByID.end()) {
+        return id_it->second;
+    }
+
+    return nullptr;
+#else
     std::map<NameKeyType, TeamPrototype *>::iterator it;
 
     for (it = m_prototypes.begin(); it != m_prototypes.end(); ++it) {
@@ -229,6 +252,7 @@ TeamPrototype *TeamFactory::Find_Team_Prototype_By_ID(unsigned int id)
     }
 
     return nullptr;
+#endif
 }
 
 Team *TeamFactory::Find_Team_By_ID(unsigned int id)
@@ -1193,6 +1217,11 @@ void Team::Heal_All_Objects()
 
 int Team::Count_Buildings()
 {
+#ifndef GAME_DLL
+    BitFlags<KINDOF_COUNT> structure;
+    structure.Set(KINDOF_STRUCTURE, true);
+    return Count_Member_Templates(structure, KINDOFMASK_NONE);
+#else
     int count = 0;
     DLINK_ITERATOR<Object> it = Iterate_Team_Member_List();
 
@@ -1209,10 +1238,14 @@ int Team::Count_Buildings()
     }
 
     return count;
+#endif
 }
 
 int Team::Count_Objects(BitFlags<KINDOF_COUNT> must_be_set, BitFlags<KINDOF_COUNT> must_be_clear)
 {
+#ifndef GAME_DLL
+    return Count_Member_Templates(must_be_set, must_be_clear);
+#else
     int count = 0;
     DLINK_ITERATOR<Object> it = Iterate_Team_Member_List();
 
@@ -1228,11 +1261,60 @@ int Team::Count_Objects(BitFlags<KINDOF_COUNT> must_be_set, BitFlags<KINDOF_COUN
         it.Advance();
     }
 
+    return count;
+#endif
+}
+
+#ifndef GAME_DLL
+void Team::Adjust_Member_Template_Count(Object *object, int delta)
+{
+    const ThingTemplate *tmplate = object->Get_Template();
+
+    for (auto it = m_memberTemplateCounts.begin(); it != m_memberTemplateCounts.end(); ++it) {
+        if (it->first == tmplate) {
+            it->second += delta;
+
+            if (it->second <= 0) {
+                m_memberTemplateCounts.erase(it);
+            }
+
+            return;
+        }
+    }
+
+    captainslog_dbgassert(delta > 0, "Removing a team member whose template was never counted");
+
+    if (delta > 0) {
+        m_memberTemplateCounts.push_back(std::make_pair(tmplate, delta));
+    }
+}
+
+// Number of members whose template matches the KindOf masks, dead or alive.
+int Team::Count_Member_Templates(BitFlags<KINDOF_COUNT> must_be_set, BitFlags<KINDOF_COUNT> must_be_clear) const
+{
+    int count = 0;
+
+    for (auto it = m_memberTemplateCounts.begin(); it != m_memberTemplateCounts.end(); ++it) {
+        if (it->first != nullptr && it->first->Is_KindOf_Multi(must_be_set, must_be_clear)) {
+            count += it->second;
+        }
+    }
+
     return count;
 }
+#endif
 
 bool Team::Has_Any_Buildings() const
 {
+#ifndef GAME_DLL
+    BitFlags<KINDOF_COUNT> structure;
+    structure.Set(KINDOF_STRUCTURE, true);
+
+    if (Count_Member_Templates(structure, KINDOFMASK_NONE) == 0) {
+        return false;
+    }
+#endif
+
     DLINK_ITERATOR<Object> it = Iterate_Team_Member_List();
 
     while (!it.Done()) {
@@ -1253,6 +1335,15 @@ bool Team::Has_Any_Buildings() const
 
 bool Team::Has_Any_Buildings(BitFlags<KINDOF_COUNT> must_be_set) const
 {
+#ifndef GAME_DLL
+    BitFlags<KINDOF_COUNT> structure = must_be_set;
+    structure.Set(KINDOF_STRUCTURE, true);
+
+    if (Count_Member_Templates(structure, KINDOFMASK_NONE) == 0) {
+        return false;
+    }
+#endif
+
     DLINK_ITERATOR<Object> it = Iterate_Team_Member_List();
 
     while (!it.Done()) {
@@ -1275,6 +1366,17 @@ bool Team::Has_Any_Buildings(BitFlags<KINDOF_COUNT> must_be_set) const
 
 bool Team::Has_Any_Units() const
 {
+#ifndef GAME_DLL
+    BitFlags<KINDOF_COUNT> not_units;
+    not_units.Set(KINDOF_STRUCTURE, true);
+    not_units.Set(KINDOF_PROJECTILE, true);
+    not_units.Set(KINDOF_MINE, true);
+
+    if (Count_Member_Templates(KINDOFMASK_NONE, not_units) == 0) {
+        return false;
+    }
+#endif
+
     DLINK_ITERATOR<Object> it = Iterate_Team_Member_List();
 
     while (!it.Done()) {
@@ -1299,6 +1401,17 @@ bool Team::Has_Any_Units() const
 
 bool Team::Has_Any_Objects() const
 {
+#ifndef GAME_DLL
+    BitFlags<KINDOF_COUNT> not_objects;
+    not_objects.Set(KINDOF_PROJECTILE, true);
+    not_objects.Set(KINDOF_INERT, true);
+    not_objects.Set(KINDOF_MINE, true);
+
+    if (Count_Member_Templates(KINDOFMASK_NONE, not_objects) == 0) {
+        return false;
+    }
+#endif
+
     DLINK_ITERATOR<Object> it = Iterate_Team_Member_List();
 
     while (!it.Done()) {
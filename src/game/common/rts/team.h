@@ -25,6 +25,7 @@
 #include "snapshot.h"
 #include <list>
 #include <map>
+#include <vector>
 
 #ifdef THYME_USE_STLPORT
 #include <hash_map>
@@ -126,6 +127,13 @@ private:
     std::map<NameKeyType, TeamPrototype *> m_prototypes;
     unsigned int m_nextPrototypeID;
     unsigned int m_nextTeamID;
+#ifndef GAME_DLL
+#ifdef THYME_USE_STLPORT
+    std::hash_map<unsigned int, TeamPrototype *> m_prototypesByID;
+#else
+    std::unordered_map<unsigned int, TeamPrototype *> m_prototypesByID;
+#endif
+#endif
 };
 
 struct TCreateUnitsInfo
@@ -313,6 +321,9 @@ public:
         captainslog_dbgassert(((uintptr_t)m_dlinkhead_TeamMemberList.m_head & 1) == 0, "bogus head ptr");
         if (!Is_In_List_Team_Member_List(object)) {
             object->DLink_Prepend_To_Team_Member_List(&m_dlinkhead_TeamMemberList.m_head);
+#ifndef GAME_DLL
+            Adjust_Member_Template_Count(object, 1);
+#endif
         }
     }
 
@@ -321,6 +332,9 @@ public:
         captainslog_dbgassert(((uintptr_t)m_dlinkhead_TeamMemberList.m_head & 1) == 0, "bogus head ptr");
         if (Is_In_List_Team_Member_List(object)) {
             object->DLink_Remove_From_Team_Member_List(&m_dlinkhead_TeamMemberList.m_head);
+#ifndef GAME_DLL
+            Adjust_Member_Template_Count(object, -1);
+#endif
         }
     }
 
@@ -365,6 +379,11 @@ public:
     }
 
 private:
+#ifndef GAME_DLL
+    void Adjust_Member_Template_Count(Object *object, int delta);
+    int Count_Member_Templates(BitFlags<KINDOF_COUNT> must_be_set, BitFlags<KINDOF_COUNT> must_be_clear) const;
+#endif
+
     struct DLINKHEAD_TeamMemberList
     {
         DLINKHEAD_TeamMemberList() : m_head(nullptr) {}
@@ -409,6 +428,11 @@ private:
     TeamRelationMap *m_teamRelations;
     PlayerRelationMap *m_playerRelations;
     std::list<ObjectID> m_objectIDList;
+#ifndef GAME_DLL
+    // How many members use each template, KindOf comes from the template so counts by KindOf only need to look at the
+    // distinct templates rather than every member.
+    std::vector<std::pair<const ThingTemplate *, int>> m_memberTemplateCounts;
+#endif
 };
 
 class TeamPrototype : public MemoryPoolObject, public SnapShot
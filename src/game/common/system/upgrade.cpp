@@ -29,6 +29,10 @@ UpgradeCenter::~UpgradeCenter()
         m_upgradeList->Delete_Instance();
         m_upgradeList = tmplate;
     }
+
+#ifndef GAME_DLL
+    m_upgradeMap.clear();
+#endif
 }
 
 void UpgradeCenter::Init()
@@ -36,6 +40,10 @@ void UpgradeCenter::Init()
     New_Upgrade("")->Friend_Make_Veterancy_Upgrade(VETERANCY_VETERAN);
     New_Upgrade("")->Friend_Make_Veterancy_Upgrade(VETERANCY_ELITE);
     New_Upgrade("")->Friend_Make_Veterancy_Upgrade(VETERANCY_HEROIC);
+#ifndef GAME_DLL
+    // The veterancy upgrades were indexed under the empty name before being renamed.
+    Rebuild_Upgrade_Map();
+#endif
 }
 
 void UpgradeCenter::Reset()
@@ -69,6 +77,9 @@ const UpgradeTemplate *UpgradeCenter::Find_Veterancy_Upgrade(VeterancyLevel leve
 
 const UpgradeTemplate *UpgradeCenter::Find_Upgrade_By_Key(NameKeyType key)
 {
+#ifndef GAME_DLL
+    return Find_Non_Const_Upgrade_By_Key(key);
+#else
     for (UpgradeTemplate *tmplate = m_upgradeList; tmplate != nullptr; tmplate = tmplate->Friend_Get_Next()) {
         if (tmplate->Get_Name_Key() == key) {
             return tmplate;
@@ -76,10 +87,20 @@ const UpgradeTemplate *UpgradeCenter::Find_Upgrade_By_Key(NameKeyType key)
     }
 
     return nullptr;
+#endif
 }
 
 UpgradeTemplate *UpgradeCenter::Find_Non_Const_Upgrade_By_Key(NameKeyType key)
 {
+#ifndef GAME_DLL
+    auto it = m_upgradeMap.find(key);
+
+    if (it != m_upgradeMap.end()) {
+        return it->second;
+    }
+
+    return nullptr;
+#else
     for (UpgradeTemplate *tmplate = m_upgradeList; tmplate != nullptr; tmplate = tmplate->Friend_Get_Next()) {
         if (tmplate->Get_Name_Key() == key) {
             return tmplate;
@@ -87,8 +108,21 @@ UpgradeTemplate *UpgradeCenter::Find_Non_Const_Upgrade_By_Key(NameKeyType key)
     }
 
     return nullptr;
+#endif
 }
 
+#ifndef GAME_DLL
+// Maps each key to the first matching upgrade in the list, which is what a search of the list finds.
+void UpgradeCenter::Rebuild_Upgrade_Map()
+{
+    m_upgradeMap.clear();
+
+    for (UpgradeTemplate *tmplate = m_upgradeList; tmplate != nullptr; tmplate = tmplate->Friend_Get_Next()) {
+        m_upgradeMap.insert(std::make_pair(tmplate->Get_Name_Key(), tmplate));
+    }
+}
+#endif
+
 Upgrade::Upgrade(const UpgradeTemplate *upgrade_template) :
     m_template(upgrade_template), m_status(UPGRADE_STATUS_INVALID), m_next(nullptr), m_prev(nullptr)
 {
@@ -149,6 +183,9 @@ void UpgradeCenter::Link_Upgrade(UpgradeTemplate *upgrade)
         }
 
         m_upgradeList = upgrade;
+#ifndef GAME_DLL
+        m_upgradeMap[upgrade->Get_Name_Key()] = upgrade;
+#endif
     }
 }
 
@@ -164,6 +201,10 @@ void UpgradeCenter::Unlink_Upgrade(UpgradeTemplate *upgrade)
         } else {
             m_upgradeList = upgrade->Friend_Get_Next();
         }
+
+#ifndef GAME_DLL
+        Rebuild_Upgrade_Map();
+#endif
     }
 }
 
@@ -18,8 +18,15 @@
 #include "audioeventrts.h"
 #include "mempoolobj.h"
 #include "namekeygenerator.h"
+#include "rtsutils.h"
 #include "subsysteminterface.h"
 
+#ifdef THYME_USE_STLPORT
+#include <hash_map>
+#else
+#include <unordered_map>
+#endif
+
 class Image;
 
 enum UpgradeType
@@ -107,9 +114,20 @@ public:
     static void Parse_Upgrade_Definition(INI *ini);
 
 private:
+#ifndef GAME_DLL
+    void Rebuild_Upgrade_Map();
+#endif
+
     UpgradeTemplate *m_upgradeList;
     int m_upgradeCount;
     bool m_buttonImagesCached;
+#ifndef GAME_DLL
+#ifdef THYME_USE_STLPORT
+    std::hash_map<NameKeyType, UpgradeTemplate *, rts::hash<NameKeyType>, std::equal_to<NameKeyType>> m_upgradeMap;
+#else
+    std::unordered_map<NameKeyType, UpgradeTemplate *, rts::hash<NameKeyType>, std::equal_to<NameKeyType>> m_upgradeMap;
+#endif
+#endif
 };
 
 class Upgrade : public MemoryPoolObject, public SnapShot
@@ -195,6 +195,7 @@ Object *ThingFactory::New_Object(const ThingTemplate *tmplate, Team *team, BitFl
 
     Object *object = g_theGameLogic->Friend_Create_Object(tmplate, status_bits, team);
 
+#ifdef GAME_DLL
     for (BehaviorModule **i = object->Get_All_Modules(); *i != nullptr; i++) {
         CreateModuleInterface *create = (*i)->Get_Create();
 
@@ -202,6 +203,14 @@ Object *ThingFactory::New_Object(const ThingTemplate *tmplate, Team *team, BitFl
             create->On_Create();
         }
     }
+#else
+    const ModuleDispatchTable *dispatch = object->Get_Module_Dispatch_Table();
+    BehaviorModule **modules = object->Get_All_Modules();
+
+    for (auto i = dispatch->create.begin(); i != dispatch->create.end(); ++i) {
+        modules[*i]->Get_Create()->On_Create();
+    }
+#endif
 
     g_thePartitionManager->Register_Object(object);
     object->Init_Object();
@@ -34,6 +34,7 @@ class DynamicAudioEventRTS;
 class Image;
 
 class AIUpdateModuleData;
+class ModuleData;
 class Player;
 
 enum NameKeyType : int32_t;
@@ -47,6 +48,24 @@ enum RadarPriorityType
     RADAR_PRIORITY_NUM_PRIORITIES,
 };
 
+#ifndef GAME_DLL
+// Indices into an object's module array of the modules implementing each interface, taken from the first object made
+// from a template. The module data of each slot is kept so other objects can check their modules line up before using it.
+// There are no damage or contain lists. Damage modules are only walked by the body modules, which still live in the
+// original binary, and an object's single contain module is already cached in Object::m_contain when it is built.
+struct ModuleDispatchTable
+{
+    ModuleDispatchTable() : built(false) {}
+
+    bool built;
+    std::vector<const ModuleData *> module_data;
+    std::vector<unsigned short> create;
+    std::vector<unsigned short> update;
+    std::vector<unsigned short> die;
+    std::vector<unsigned short> collide;
+};
+#endif
+
 enum EditorSortingType
 {
     ES_FIRST = 0,
@@ -322,6 +341,9 @@ public:
     int Is_Buildable_Item() const { return m_buildCost != 0; }
 
     ThingTemplate *Friend_Get_Next_Template() const { return m_nextThingTemplate; }
+#ifndef GAME_DLL
+    ModuleDispatchTable &Friend_Get_Module_Dispatch_Table() const { return m_moduleDispatchTable; }
+#endif
     void Friend_Set_Next_Template(ThingTemplate *tmplate) { m_nextThingTemplate = tmplate; }
     void Friend_Set_Template_Name(Utf8String name) { m_nameString = name; }
     void Friend_Set_Template_ID(unsigned short id) { m_templateID = id; }
@@ -409,6 +431,10 @@ private:
     unsigned char m_moduleParseState;
     unsigned char m_crusherLevel;
     unsigned char m_crushableLevel;
+#ifndef GAME_DLL
+    // Not copied by operator=, an override can have different modules to the template it overrides.
+    mutable ModuleDispatchTable m_moduleDispatchTable;
+#endif
 
 #ifdef GAME_DLL
     static AudioEventRTS &s_audioEventNoSound;
@@ -16,6 +16,7 @@
 #include "globaldata.h"
 #include "terrainlogic.h"
 #include "xfer.h"
+#include <algorithm>
 #ifdef GAME_DLL
 #include "hooker.h"
 #endif
@@ -25,6 +26,15 @@ PolygonTrigger *PolygonTrigger::s_thePolygonTriggerListPtr = nullptr;
 #endif
 
 int PolygonTrigger::s_currentID = 1;
+std::vector<std::vector<PolygonTrigger *>> PolygonTrigger::s_triggerGrid;
+IRegion2D PolygonTrigger::s_triggerGridBounds;
+int PolygonTrigger::s_triggerGridCellSize = 1;
+int PolygonTrigger::s_triggerGridWidth = 0;
+int PolygonTrigger::s_triggerGridHeight = 0;
+bool PolygonTrigger::s_triggerGridDirty = true;
+
+// Upper limit on cells along each axis of the trigger grid.
+static const int TRIGGER_GRID_MAX_CELLS = 64;
 
 // BUGFIX initalize all variables
 PolygonTrigger::PolygonTrigger(int initial_allocation) :
@@ -83,6 +93,7 @@ void PolygonTrigger::Xfer_Snapshot(Xfer *xfer)
     xfer->xferIRegion2D(&m_bounds);
     xfer->xferReal(&m_radius);
     xfer->xferBool(&m_boundsNeedsUpdate);
+    s_triggerGridDirty = true;
 }
 
 void PolygonTrigger::Reallocate()
@@ -144,6 +155,7 @@ void PolygonTrigger::Add_Point(ICoord3D const &point)
     m_points[m_numPoints] = point;
     m_numPoints++;
     m_boundsNeedsUpdate = true;
+    s_triggerGridDirty = true;
 }
 
 void PolygonTrigger::Set_Point(ICoord3D const &point, int ndx)
@@ -156,6 +168,7 @@ void PolygonTrigger::Set_Point(ICoord3D const &point, int ndx)
         } else if (ndx <= m_numPoints) {
             m_points[ndx] = point;
             m_boundsNeedsUpdate = true;
+            s_triggerGridDirty = true;
         }
     }
 }
@@ -179,6 +192,7 @@ void PolygonTrigger::Insert_Point(ICoord3D const &point, int ndx)
             m_points[ndx] = point;
             m_numPoints++;
             m_boundsNeedsUpdate = true;
+            s_triggerGridDirty = true;
         }
     }
 }
@@ -194,6 +208,7 @@ void PolygonTrigger::Delete_Point(int ndx)
 
         m_numPoints--;
         m_boundsNeedsUpdate = true;
+        s_triggerGridDirty = true;
     }
 }
 
@@ -238,6 +253,7 @@ void PolygonTrigger::Add_Polygon_Trigger(PolygonTrigger *trigger)
 
     trigger->m_nextPolygonTrigger = s_thePolygonTriggerListPtr;
     s_thePolygonTriggerListPtr = trigger;
+    s_triggerGridDirty = true;
 }
 
 void PolygonTrigger::Remove_Polygon_Trigger(PolygonTrigger *trigger)
@@ -262,6 +278,7 @@ void PolygonTrigger::Remove_Polygon_Trigger(PolygonTrigger *trigger)
     }
 
     trigger->m_nextPolygonTrigger = nullptr;
+    s_triggerGridDirty = true;
 }
 
 PolygonTrigger *PolygonTrigger::Get_Polygon_Trigger_By_ID(int id)
@@ -395,9 +412,89 @@ void PolygonTrigger::Delete_Triggers()
     PolygonTrigger *p = s_thePolygonTriggerListPtr;
     s_thePolygonTriggerListPtr = nullptr;
     s_currentID = 1;
+    s_triggerGrid.clear();
+    s_triggerGridDirty = true;
     p->Delete_Instance();
 }
 
+void PolygonTrigger::Build_Trigger_Grid()
+{
+    s_triggerGrid.clear();
+    s_triggerGridWidth = 0;
+    s_triggerGridHeight = 0;
+    s_triggerGridDirty = false;
+    bool have_bounds = false;
+
+    for (PolygonTrigger *p = Get_First_Polygon_Trigger(); p != nullptr; p = p->Get_Next()) {
+        if (p->m_boundsNeedsUpdate) {
+            p->Update_Bounds();
+        }
+
+        // Triggers without points have inverted bounds and can never contain a point.
+        if (p->m_bounds.lo.x > p->m_bounds.hi.x || p->m_bounds.lo.y > p->m_bounds.hi.y) {
+            continue;
+        }
+
+        if (!have_bounds) {
+            s_triggerGridBounds = p->m_bounds;
+            have_bounds = true;
+        } else {
+            s_triggerGridBounds.lo.x = std::min(s_triggerGridBounds.lo.x, p->m_bounds.lo.x);
+            s_triggerGridBounds.lo.y = std::min(s_triggerGridBounds.lo.y, p->m_bounds.lo.y);
+            s_triggerGridBounds.hi.x = std::max(s_triggerGridBounds.hi.x, p->m_bounds.hi.x);
+            s_triggerGridBounds.hi.y = std::max(s_triggerGridBounds.hi.y, p->m_bounds.hi.y);
+        }
+    }
+
+    if (!have_bounds) {
+        return;
+    }
+
+    int extent =
+        std::max(s_triggerGridBounds.hi.x - s_triggerGridBounds.lo.x, s_triggerGridBounds.hi.y - s_triggerGridBounds.lo.y);
+    s_triggerGridCellSize = extent / TRIGGER_GRID_MAX_CELLS + 1;
+    s_triggerGridWidth = (s_triggerGridBounds.hi.x - s_triggerGridBounds.lo.x) / s_triggerGridCellSize + 1;
+    s_triggerGridHeight = (s_triggerGridBounds.hi.y - s_triggerGridBounds.lo.y) / s_triggerGridCellSize + 1;
+    s_triggerGrid.resize(s_triggerGridWidth * s_triggerGridHeight);
+
+    for (PolygonTrigger *p = Get_First_Polygon_Trigger(); p != nullptr; p = p->Get_Next()) {
+        if (p->m_bounds.lo.x > p->m_bounds.hi.x || p->m_bounds.lo.y > p->m_bounds.hi.y) {
+            continue;
+        }
+
+        int lo_x = (p->m_bounds.lo.x - s_triggerGridBounds.lo.x) / s_triggerGridCellSize;
+        int lo_y = (p->m_bounds.lo.y - s_triggerGridBounds.lo.y) / s_triggerGridCellSize;
+        int hi_x = (p->m_bounds.hi.x - s_triggerGridBounds.lo.x) / s_triggerGridCellSize;
+        int hi_y = (p->m_bounds.hi.y - s_triggerGridBounds.lo.y) / s_triggerGridCellSize;
+
+        for (int y = lo_y; y <= hi_y; y++) {
+            for (int x = lo_x; x <= hi_x; x++) {
+                s_triggerGrid[y * s_triggerGridWidth + x].push_back(p);
+            }
+        }
+    }
+}
+
+// Returns the triggers whose bounds cover the grid cell containing the point, in list order, or nullptr if no trigger
+// can contain it. The result is only valid until the trigger list or any trigger's points change.
+const std::vector<PolygonTrigger *> *PolygonTrigger::Get_Triggers_Near_Point(const ICoord3D &point)
+{
+    if (s_triggerGridDirty) {
+        Build_Trigger_Grid();
+    }
+
+    if (s_triggerGrid.empty() || point.x < s_triggerGridBounds.lo.x || point.y < s_triggerGridBounds.lo.y
+        || point.x > s_triggerGridBounds.hi.x || point.y > s_triggerGridBounds.hi.y) {
+        return nullptr;
+    }
+
+    int x = (point.x - s_triggerGridBounds.lo.x) / s_triggerGridCellSize;
+    int y = (point.y - s_triggerGridBounds.lo.y) / s_triggerGridCellSize;
+    const std::vector<PolygonTrigger *> &cell = s_triggerGrid[y * s_triggerGridWidth + x];
+
+    return cell.empty() ? nullptr : &cell;
+}
+
 // Seems to be related to https://wrf.ecse.rpi.edu/Research/Short_Notes/pnpoly.html
 bool PolygonTrigger::Point_In_Trigger(ICoord3D &point) const
 {
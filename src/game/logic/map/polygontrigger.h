@@ -17,6 +17,7 @@
 #include "always.h"
 #include "datachunk.h"
 #include "terrainlogic.h"
+#include <vector>
 
 class PolygonTrigger : public MemoryPoolObject, public SnapShot
 {
@@ -45,7 +46,11 @@ public:
     void Set_Trigger_Name(Utf8String name) { m_triggerName = name; }
     int Get_ID() { return m_triggerID; }
     void Set_Do_Export_With_Scripts(bool do_export) { m_exportWithScripts = do_export; }
-    void Set_Next(PolygonTrigger *next) { m_nextPolygonTrigger = next; }
+    void Set_Next(PolygonTrigger *next)
+    {
+        m_nextPolygonTrigger = next;
+        s_triggerGridDirty = true;
+    }
     void Set_Water_Area(bool water) { m_isWaterArea = water; }
     void Set_River(bool river) { m_isRiver = river; }
     void Set_River_Start(int start) { m_riverStart = start; }
@@ -85,6 +90,7 @@ public:
     bool Is_Valid() const;
 
     static PolygonTrigger *Get_First_Polygon_Trigger() { return s_thePolygonTriggerListPtr; }
+    static const std::vector<PolygonTrigger *> *Get_Triggers_Near_Point(const ICoord3D &point);
 
     static bool Parse_Polygon_Triggers_Data_Chunk(DataChunkInput &file, DataChunkInfo *info, void *user_data);
     static void Delete_Triggers();
@@ -102,6 +108,17 @@ private:
 #endif
     static int s_currentID;
 
+    static void Build_Trigger_Grid();
+
+    // Grid of trigger bounds used to find the triggers that may contain a point without walking the whole list. Each
+    // cell lists its triggers in list order so callers visit them in the same order as a full list walk would.
+    static std::vector<std::vector<PolygonTrigger *>> s_triggerGrid;
+    static IRegion2D s_triggerGridBounds;
+    static int s_triggerGridCellSize;
+    static int s_triggerGridWidth;
+    static int s_triggerGridHeight;
+    static bool s_triggerGridDirty;
+
     PolygonTrigger *m_nextPolygonTrigger;
     Utf8String m_triggerName;
     int m_triggerID;
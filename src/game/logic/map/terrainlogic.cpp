@@ -922,10 +922,79 @@ void TerrainLogic::Add_Waypoint(MapObject *map_obj)
         new Waypoint(map_obj->Get_Waypoint_ID(), map_obj->Get_Waypoint_Name(), &loc, label1, label2, label3, bidir);
     waypoint->Set_Next(m_waypointListHead);
     m_waypointListHead = waypoint;
+#ifndef GAME_DLL
+    Index_Waypoint(waypoint);
+#endif
+}
+
+#ifndef GAME_DLL
+// Walks the waypoint list for IDs the lookup tables don't hold. The list is newest first, oldest picks the last match.
+Waypoint *TerrainLogic::Find_Waypoint_By_ID_In_List(WaypointID id, bool oldest)
+{
+    Waypoint *found = nullptr;
+
+    for (Waypoint *waypoint = Get_First_Waypoint(); waypoint != nullptr; waypoint = waypoint->Get_Next()) {
+        if (waypoint->Get_ID() == id) {
+            found = waypoint;
+
+            if (!oldest) {
+                break;
+            }
+        }
+    }
+
+    return found;
+}
+
+void TerrainLogic::Index_Waypoint(Waypoint *waypoint)
+{
+    // Later waypoints take precedence for lookups, matching the head first order of the waypoint list. Links resolve to
+    // the earliest waypoint with an ID, as the list walk in the original Add_Waypoint_Link does.
+    int id = waypoint->Get_ID();
+
+    if (id >= 0 && id < MAX_INDEXED_WAYPOINT_ID) {
+        if (static_cast<size_t>(id) >= m_waypointsByID.size()) {
+            m_waypointsByID.resize(id + 1, nullptr);
+            m_firstWaypointsByID.resize(id + 1, nullptr);
+        }
+
+        m_waypointsByID[id] = waypoint;
+
+        if (m_firstWaypointsByID[id] == nullptr) {
+            m_firstWaypointsByID[id] = waypoint;
+        }
+    }
+
+    m_waypointsByName[waypoint->Get_Name()] = waypoint;
+
+    Utf8String label1 = waypoint->Get_Path_Label_1();
+    Utf8String label2 = waypoint->Get_Path_Label_2();
+    Utf8String label3 = waypoint->Get_Path_Label_3();
+    label1.To_Lower();
+    label2.To_Lower();
+    label3.To_Lower();
+    Index_Waypoint_Path_Label(waypoint, label1);
+
+    if (label2 != label1) {
+        Index_Waypoint_Path_Label(waypoint, label2);
+    }
+
+    if (label3 != label1 && label3 != label2) {
+        Index_Waypoint_Path_Label(waypoint, label3);
+    }
+}
+
+void TerrainLogic::Index_Waypoint_Path_Label(Waypoint *waypoint, Utf8String label)
+{
+    if (label.Is_Not_Empty()) {
+        m_waypointsByPathLabel[label].push_back(waypoint);
+    }
 }
+#endif
 
 void TerrainLogic::Add_Waypoint_Link(int id1, int id2)
 {
+#ifdef GAME_DLL
     Waypoint *waypoint1 = nullptr;
     Waypoint *waypoint2 = nullptr;
 
@@ -938,6 +1007,22 @@ void TerrainLogic::Add_Waypoint_Link(int id1, int id2)
             waypoint2 = waypoint;
         }
     }
+#else
+    Waypoint *waypoint1 = nullptr;
+    Waypoint *waypoint2 = nullptr;
+
+    if (id1 >= 0 && static_cast<size_t>(id1) < m_firstWaypointsByID.size()) {
+        waypoint1 = m_firstWaypointsByID[id1];
+    } else if (id1 >= MAX_INDEXED_WAYPOINT_ID) {
+        waypoint1 = Find_Waypoint_By_ID_In_List(static_cast<WaypointID>(id1), true);
+    }
+
+    if (id2 >= 0 && static_cast<size_t>(id2) < m_firstWaypointsByID.size()) {
+        waypoint2 = m_firstWaypointsByID[id2];
+    } else if (id2 >= MAX_INDEXED_WAYPOINT_ID) {
+        waypoint2 = Find_Waypoint_By_ID_In_List(static_cast<WaypointID>(id2), true);
+    }
+#endif
 
     if (waypoint1 != nullptr && waypoint2 != nullptr && waypoint1 != waypoint2) {
         for (int i = 0; i < waypoint1->Get_Num_Links(); i++) {
@@ -970,6 +1055,12 @@ void TerrainLogic::Delete_Waypoints()
     }
 
     m_waypointListHead = nullptr;
+#ifndef GAME_DLL
+    m_waypointsByID.clear();
+    m_firstWaypointsByID.clear();
+    m_waypointsByName.clear();
+    m_waypointsByPathLabel.clear();
+#endif
 }
 
 void TerrainLogic::Add_Bridge_To_Logic(BridgeInfo *info, Dict *props, Utf8String bridge_template_name)
@@ -990,6 +1081,7 @@ void TerrainLogic::Add_Landmark_Bridge_To_Logic(Object *obj)
 
 Waypoint *TerrainLogic::Get_Waypoint_By_Name(Utf8String name)
 {
+#ifdef GAME_DLL
     for (Waypoint *waypoint = Get_First_Waypoint(); waypoint != nullptr; waypoint = waypoint->Get_Next()) {
         if (name == waypoint->Get_Name()) {
             return waypoint;
@@ -997,10 +1089,20 @@ Waypoint *TerrainLogic::Get_Waypoint_By_Name(Utf8String name)
     }
 
     return nullptr;
+#else
+    auto it = m_waypointsByName.find(name);
+
+    if (it != m_waypointsByName.end()) {
+        return it->second;
+    }
+
+    return nullptr;
+#endif
 }
 
 Waypoint *TerrainLogic::Get_Waypoint_By_ID(WaypointID id)
 {
+#ifdef GAME_DLL
     for (Waypoint *waypoint = Get_First_Waypoint(); waypoint != nullptr; waypoint = waypoint->Get_Next()) {
         if (waypoint->Get_ID() == id) {
             return waypoint;
@@ -1008,6 +1110,17 @@ Waypoint *TerrainLogic::Get_Waypoint_By_ID(WaypointID id)
     }
 
     return nullptr;
+#else
+    if (id >= 0 && static_cast<size_t>(id) < m_waypointsByID.size()) {
+        return m_waypointsByID[id];
+    }
+
+    if (id >= MAX_INDEXED_WAYPOINT_ID) {
+        return Find_Waypoint_By_ID_In_List(id, false);
+    }
+
+    return nullptr;
+#endif
 }
 
 Waypoint *TerrainLogic::Get_Closest_Waypoint_On_Path(const Coord3D *pos, Utf8String label)
@@ -1019,6 +1132,7 @@ Waypoint *TerrainLogic::Get_Closest_Waypoint_On_Path(const Coord3D *pos, Utf8Str
         captainslog_debug("***Warning - asking for empty path label.");
         return nullptr;
     } else {
+#ifdef GAME_DLL
         for (Waypoint *w = Get_First_Waypoint(); w != nullptr; w = w->Get_Next()) {
             bool found = false;
 
@@ -1049,6 +1163,26 @@ Waypoint *TerrainLogic::Get_Closest_Waypoint_On_Path(const Coord3D *pos, Utf8Str
                 }
             }
         }
+#else
+        Utf8String key = label;
+        key.To_Lower();
+        auto it = m_waypointsByPathLabel.find(key);
+
+        if (it == m_waypointsByPathLabel.end()) {
+            return nullptr;
+        }
+
+        // Walk backwards so ties resolve to the same waypoint as a walk of the head first waypoint list.
+        for (auto w = it->second.rbegin(); w != it->second.rend(); ++w) {
+            const Coord3D *loc = (*w)->Get_Location();
+            float dist = (loc->x - pos->x) * (loc->x - pos->x) + (loc->y - pos->y) * (loc->y - pos->y);
+
+            if (waypoint == nullptr || dist < distance) {
+                waypoint = *w;
+                distance = dist;
+            }
+        }
+#endif
 
         return waypoint;
     }
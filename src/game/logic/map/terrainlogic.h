@@ -19,10 +19,15 @@
 #include "coord.h"
 #include "gametype.h"
 #include "mempoolobj.h"
+#include "rtsutils.h"
 #include "snapshot.h"
 #include "subsysteminterface.h"
 #include "terrainroads.h"
 
+#ifndef GAME_DLL
+#include <unordered_map>
+#endif
+
 struct DataChunkInfo;
 class DataChunkInput;
 class Dict;
@@ -249,6 +254,12 @@ public:
     static bool Parse_Waypoint_Data_Chunk(DataChunkInput &file, DataChunkInfo *info, void *user_data);
 
 protected:
+#ifndef GAME_DLL
+    Waypoint *Find_Waypoint_By_ID_In_List(WaypointID id, bool oldest);
+    void Index_Waypoint(Waypoint *waypoint);
+    void Index_Waypoint_Path_Label(Waypoint *waypoint, Utf8String label);
+#endif
+
 #ifdef GAME_DLL
     static WaterHandle &m_gridWaterHandle;
 #else
@@ -281,6 +292,21 @@ protected:
     bool m_waterGridEnabled;
     DynamicWaterEntry m_waterToUpdate[MAX_DYNAMIC_WATER];
     int m_numWaterToUpdate;
+#ifndef GAME_DLL
+    // Waypoint lookup tables, filled in as waypoints are added so script queries don't walk the list. IDs at or above
+    // MAX_INDEXED_WAYPOINT_ID are left to the list walk so a bad ID in a map can't size the table.
+    enum
+    {
+        MAX_INDEXED_WAYPOINT_ID = 0x10000,
+    };
+    std::vector<Waypoint *> m_waypointsByID;
+    // The first waypoint added with each ID, which waypoint links resolve to.
+    std::vector<Waypoint *> m_firstWaypointsByID;
+    std::unordered_map<Utf8String, Waypoint *, rts::hash<Utf8String>, std::equal_to<Utf8String>> m_waypointsByName;
+    // Waypoints per lower cased path label in the order they were added.
+    std::unordered_map<Utf8String, std::vector<Waypoint *>, rts::hash<Utf8String>, std::equal_to<Utf8String>>
+        m_waypointsByPathLabel;
+#endif
 };
 
 #ifdef GAME_DLL
@@ -20,9 +20,18 @@
 #include "namekeygenerator.h"
 #include "overridable.h"
 #include "physicsupdate.h"
+#include "rtsutils.h"
 #include "snapshot.h"
 #include <map>
 
+#ifndef GAME_DLL
+#ifdef THYME_USE_STLPORT
+#include <hash_map>
+#else
+#include <unordered_map>
+#endif
+#endif
+
 class Object;
 class Locomotor;
 
@@ -171,7 +180,15 @@ public:
     static void Parse_Locomotor_Template_Definition(INI *ini);
 
 private:
+#ifdef GAME_DLL
     std::map<NameKeyType, LocomotorTemplate *> m_locomotorTemplates;
+#elif defined THYME_USE_STLPORT
+    std::hash_map<NameKeyType, LocomotorTemplate *, rts::hash<NameKeyType>, std::equal_to<NameKeyType>>
+        m_locomotorTemplates;
+#else
+    std::unordered_map<NameKeyType, LocomotorTemplate *, rts::hash<NameKeyType>, std::equal_to<NameKeyType>>
+        m_locomotorTemplates;
+#endif
 };
 
 class Locomotor : public MemoryPoolObject, public SnapShot
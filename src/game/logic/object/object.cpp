@@ -178,6 +178,48 @@ ModelConditionFlagType s_theWeaponSetTypeToModelConditionTypeMap[] = { MODELCOND
     MODELCONDITION_RIDER7,
     MODELCONDITION_RIDER8 };
 
+#ifndef GAME_DLL
+static void Build_Module_Dispatch_Table(ModuleDispatchTable &table, BehaviorModule *const *modules)
+{
+    for (unsigned short i = 0; modules[i] != nullptr; i++) {
+        table.module_data.push_back(modules[i]->Get_Module_Data());
+
+        if (modules[i]->Get_Create() != nullptr) {
+            table.create.push_back(i);
+        }
+
+        if (modules[i]->Get_Update() != nullptr) {
+            table.update.push_back(i);
+        }
+
+        if (modules[i]->Get_Die() != nullptr) {
+            table.die.push_back(i);
+        }
+
+        if (modules[i]->Get_Collide() != nullptr) {
+            table.collide.push_back(i);
+        }
+    }
+
+    table.built = true;
+}
+
+// Modules with the same module data are the same kind of module, so if every slot matches the template's table also
+// describes these modules.
+static bool Module_Dispatch_Table_Matches(const ModuleDispatchTable &table, BehaviorModule *const *modules)
+{
+    size_t i = 0;
+
+    for (; modules[i] != nullptr; i++) {
+        if (i >= table.module_data.size() || modules[i]->Get_Module_Data() != table.module_data[i]) {
+            return false;
+        }
+    }
+
+    return i == table.module_data.size();
+}
+#endif
+
 Object::Object(const ThingTemplate *tt, BitFlags<OBJECT_STATUS_COUNT> status_bits, Team *team) :
     Thing(tt),
     m_drawable(nullptr),
@@ -404,6 +446,22 @@ Object::Object(const ThingTemplate *tt, BitFlags<OBJECT_STATUS_COUNT> status_bit
         }
 
         *modules = nullptr;
+#ifndef GAME_DLL
+        ModuleDispatchTable &dispatch = tmplate->Friend_Get_Module_Dispatch_Table();
+
+        if (!dispatch.built) {
+            Build_Module_Dispatch_Table(dispatch, m_allModules);
+        }
+
+        if (Module_Dispatch_Table_Matches(dispatch, m_allModules)) {
+            m_moduleDispatchTable = &dispatch;
+        } else {
+            // The helper modules depend on global settings too, so the odd object can differ from its template's first.
+            m_ownModuleDispatchTable = new ModuleDispatchTable;
+            Build_Module_Dispatch_Table(*m_ownModuleDispatchTable, m_allModules);
+            m_moduleDispatchTable = m_ownModuleDispatchTable;
+        }
+#endif
         AIUpdateInterface *update = Get_AI_Update_Interface();
 
         if (update != nullptr) {
@@ -490,6 +548,11 @@ Object::~Object()
 
     delete[] m_allModules;
     m_allModules = nullptr;
+#ifndef GAME_DLL
+    delete m_ownModuleDispatchTable;
+    m_ownModuleDispatchTable = nullptr;
+    m_moduleDispatchTable = nullptr;
+#endif
 
     if (m_experienceTracker != nullptr) {
         m_experienceTracker->Delete_Instance();
@@ -716,6 +779,12 @@ void Object::Xfer_Snapshot(Xfer *xfer)
     xfer->xferReal(&m_shroudClearingRange);
     xfer->xferReal(&m_shroudRange);
     m_disabledStates.Xfer(xfer);
+#ifndef GAME_DLL
+
+    if (Is_Disabled()) {
+        g_theGameLogic->Note_Object_Disabled(this);
+    }
+#endif
 
     if (xfer->Get_Mode() == XFER_SAVE || version >= 2) {
         xfer->xferBool(&m_singleUseCommand);
@@ -1515,6 +1584,7 @@ void Object::Kill(DamageType damage, DeathType death)
 
 void Object::On_Collide(Object *other, const Coord3D *loc, const Coord3D *normal)
 {
+#ifdef GAME_DLL
     for (BehaviorModule **module = m_allModules; *module != nullptr; module++) {
         CollideModuleInterface *collide = (*module)->Get_Collide();
 
@@ -1526,6 +1596,15 @@ void Object::On_Collide(Object *other, const Coord3D *loc, const Coord3D *normal
             collide->On_Collide(other, loc, normal);
         }
     }
+#else
+    for (auto i = m_moduleDispatchTable->collide.begin(); i != m_moduleDispatchTable->collide.end(); ++i) {
+        if (Get_Status_Bits().Test(OBJECT_STATUS_NO_COLLISIONS)) {
+            return;
+        }
+
+        m_allModules[*i]->Get_Collide()->On_Collide(other, loc, normal);
+    }
+#endif
 }
 
 ExitInterface *Object::Get_Object_Exit_Interface() const
@@ -1592,6 +1671,12 @@ void Object::Set_Disabled_Until(DisabledType type, unsigned int frame)
 
             m_disabledStateFrames[type] = frame;
             m_disabledStates.Set(type, g_theGameLogic->Get_Frame() < frame);
+#ifndef GAME_DLL
+
+            if (Is_Disabled()) {
+                g_theGameLogic->Note_Object_Disabled(this);
+            }
+#endif
 
             if (m_drawable != nullptr && Is_Disabled() && type != DISABLED_TYPE_DISABLED_HELD
                 && type != DISABLED_TYPE_DISABLED_SCRIPT_DISABLED && type != DISABLED_TYPE_DISABLED_UNMANNED) {
@@ -2441,7 +2526,16 @@ void Object::Set_Trigger_Area_Flags_For_Change_In_Position()
 
             m_iPos = ipos;
 
+#ifdef GAME_DLL
             for (PolygonTrigger *t = PolygonTrigger::Get_First_Polygon_Trigger(); t != nullptr; t = t->Get_Next()) {
+#else
+            // Only triggers whose bounds cover our cell can contain us, they come back in the same order as the list.
+            const std::vector<PolygonTrigger *> *triggers = PolygonTrigger::Get_Triggers_Near_Point(m_iPos);
+            size_t trigger_count = triggers != nullptr ? triggers->size() : 0;
+
+            for (size_t j = 0; j < trigger_count; j++) {
+                PolygonTrigger *t = (*triggers)[j];
+#endif
                 bool trigger_found = false;
 
                 for (int i = 0; i < m_numTriggerAreasActive; i++) {
@@ -3931,6 +4025,7 @@ unsigned int Object::Get_Disabled_Until(DisabledType type) const
 
 bool Object::Is_Salvage_Crate() const
 {
+#ifdef GAME_DLL
     for (BehaviorModule **module = m_allModules; *module != nullptr; module++) {
         CollideModuleInterface *collide = (*module)->Get_Collide();
 
@@ -3938,6 +4033,13 @@ bool Object::Is_Salvage_Crate() const
             return true;
         }
     }
+#else
+    for (auto i = m_moduleDispatchTable->collide.begin(); i != m_moduleDispatchTable->collide.end(); ++i) {
+        if (m_allModules[*i]->Get_Collide()->Is_Salvage_Crate_Collide()) {
+            return true;
+        }
+    }
+#endif
 
     return false;
 }
@@ -4063,6 +4165,7 @@ void Object::On_Die(DamageInfo *damage)
 #endif
     bool source = damage->m_in.m_sourceID == Get_ID();
 
+#ifdef GAME_DLL
     for (BehaviorModule **module = m_allModules; *module != nullptr; module++) {
         DieModuleInterface *die = (*module)->Get_Die();
 
@@ -4070,6 +4173,11 @@ void Object::On_Die(DamageInfo *damage)
             die->On_Die(damage);
         }
     }
+#else
+    for (auto i = m_moduleDispatchTable->die.begin(); i != m_moduleDispatchTable->die.end(); ++i) {
+        m_allModules[*i]->Get_Die()->On_Die(damage);
+    }
+#endif
 
     if (m_radarData != nullptr) {
         g_theRadar->Remove_Object(this);
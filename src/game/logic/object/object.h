@@ -232,6 +232,9 @@ public:
     const Object *Get_Contained_By() const { return m_containedBy; }
     Object *Get_Contained_By() { return m_containedBy; }
     BehaviorModule **Get_All_Modules() const { return m_allModules; }
+#ifndef GAME_DLL
+    const ModuleDispatchTable *Get_Module_Dispatch_Table() const { return m_moduleDispatchTable; }
+#endif
     ObjectID Get_Producer_ID() const { return m_producerID; }
     unsigned int Get_Weapon_Bonus_Condition() const { return m_weaponBonusCondition; }
     const Weapon *Get_Weapon_In_Weapon_Slot(WeaponSlotType type) const
@@ -247,6 +250,10 @@ public:
     StealthUpdate *Get_Stealth_Update() const { return m_stealth; }
     bool Get_Script_Status(ObjectScriptStatusBit status) const { return (m_scriptStatus & status) != 0; }
     Object *Get_Next_Object() { return m_next; }
+#ifndef GAME_DLL
+    unsigned int Get_List_Sequence() const { return m_listSequence; }
+    void Set_List_Sequence(unsigned int sequence) { m_listSequence = sequence; }
+#endif
     const BitFlags<OBJECT_STATUS_COUNT> &Get_Status_Bits() const { return m_status; }
     BodyModuleInterface *Get_Body_Module() const { return m_body; }
     bool Get_Disabled_State(DisabledType type) const { return m_disabledStates.Test(type); }
@@ -668,6 +675,11 @@ private:
     signed char m_numTriggerAreasActive;
     bool m_singleUseCommand;
     bool m_receivingDifficultyBonus;
+#ifndef GAME_DLL
+    unsigned int m_listSequence = 0;
+    const ModuleDispatchTable *m_moduleDispatchTable = nullptr;
+    ModuleDispatchTable *m_ownModuleDispatchTable = nullptr;
+#endif
 };
 
 extern BitFlags<OBJECT_STATUS_COUNT> OBJECT_STATUS_MASK_NONE;
@@ -17,10 +17,19 @@
 #include "always.h"
 #include "mempoolobj.h"
 #include "namekeygenerator.h"
+#include "rtsutils.h"
 #include "subsysteminterface.h"
 #include <map>
 #include <vector>
 
+#ifndef GAME_DLL
+#ifdef THYME_USE_STLPORT
+#include <hash_map>
+#else
+#include <unordered_map>
+#endif
+#endif
+
 class INI;
 class Object;
 class Coord3D;
@@ -77,7 +86,13 @@ public:
 private:
     void Clear() { m_nuggets.clear(); }
 
+#ifdef GAME_DLL
     std::map<NameKeyType, ObjectCreationList> m_ocls;
+#elif defined THYME_USE_STLPORT
+    std::hash_map<NameKeyType, ObjectCreationList, rts::hash<NameKeyType>, std::equal_to<NameKeyType>> m_ocls;
+#else
+    std::unordered_map<NameKeyType, ObjectCreationList, rts::hash<NameKeyType>, std::equal_to<NameKeyType>> m_ocls;
+#endif
     std::vector<ObjectCreationNugget *> m_nuggets;
 };
 
@@ -136,7 +136,12 @@ void WeaponStore::Set_Delayed_Damage(const WeaponTemplate *weapon,
     info.m_delaySourceID = source_id;
     info.m_delayIntendedVictimID = victim_id;
     info.m_bonus = bonus;
+#ifdef GAME_DLL
     m_weaponDDI.push_back(info);
+#else
+    info.m_sequence = m_nextDDISequence++;
+    m_weaponDDI[which_frame].push_back(info);
+#endif
 }
 
 void WeaponStore::Parse_Weapon_Template(INI *ini, void *formal, void *store, const void *user_data)
@@ -165,6 +170,9 @@ WeaponStore::~WeaponStore()
     }
 
     m_weaponTemplateVector.clear();
+#ifndef GAME_DLL
+    m_weaponTemplateMap.clear();
+#endif
 }
 
 void WeaponStore::Handle_Projectile_Detonation(const WeaponTemplate *tmplate,
@@ -192,6 +200,15 @@ void WeaponStore::Create_And_Fire_Temp_Weapon(
 
 WeaponTemplate *WeaponStore::Find_Weapon_Template_Private(NameKeyType key) const
 {
+#ifndef GAME_DLL
+    weapontemplatemap_t::const_iterator it = m_weaponTemplateMap.find(key);
+
+    if (it != m_weaponTemplateMap.end()) {
+        return it->second;
+    }
+
+    return nullptr;
+#else
     for (unsigned int i = 0; i < m_weaponTemplateVector.size(); i++) {
         WeaponTemplate *tmplate = m_weaponTemplateVector[i];
 
@@ -201,6 +218,7 @@ WeaponTemplate *WeaponStore::Find_Weapon_Template_Private(NameKeyType key) const
     }
 
     return nullptr;
+#endif
 }
 
 WeaponTemplate *WeaponStore::New_Weapon_Template(Utf8String name)
@@ -212,6 +230,10 @@ WeaponTemplate *WeaponStore::New_Weapon_Template(Utf8String name)
         tmplate->m_name = name;
         tmplate->m_nameKey = g_theNameKeyGenerator->Name_To_Key(name.Str());
         m_weaponTemplateVector.push_back(tmplate);
+#ifndef GAME_DLL
+        // Keeps the first template with a given key like the linear search did.
+        m_weaponTemplateMap.insert(weapontemplatemap_t::value_type(tmplate->m_nameKey, tmplate));
+#endif
         return tmplate;
     }
 }
@@ -230,6 +252,7 @@ WeaponTemplate *WeaponStore::New_Override(WeaponTemplate *tmplate)
 
 void WeaponStore::Update()
 {
+#ifdef GAME_DLL
     for (auto i = m_weaponDDI.begin(); i != m_weaponDDI.end();) {
         if (g_theGameLogic->Get_Frame() >= i->m_delayDamageFrame) {
             i->m_delayedWeapon->Deal_Damage_Internal(
@@ -239,11 +262,43 @@ void WeaponStore::Update()
             i++;
         }
     }
+#else
+    unsigned int frame = g_theGameLogic->Get_Frame();
+
+    // Dealing damage can queue more delayed damage, so take one entry at a time from whichever due bucket holds the
+    // oldest one. Usually only the current frame's bucket is due.
+    for (;;) {
+        auto bucket = m_weaponDDI.begin();
+
+        if (bucket == m_weaponDDI.end() || bucket->first > frame) {
+            break;
+        }
+
+        for (auto i = std::next(bucket); i != m_weaponDDI.end() && i->first <= frame; ++i) {
+            if (i->second.front().m_sequence < bucket->second.front().m_sequence) {
+                bucket = i;
+            }
+        }
+
+        WeaponDelayedDamageInfo info = bucket->second.front();
+        bucket->second.pop_front();
+
+        if (bucket->second.empty()) {
+            m_weaponDDI.erase(bucket);
+        }
+
+        info.m_delayedWeapon->Deal_Damage_Internal(
+            info.m_delaySourceID, info.m_delayIntendedVictimID, &info.m_delayDamagePos, info.m_bonus, false);
+    }
+#endif
 }
 
 void WeaponStore::Delete_All_Delayed_Damage()
 {
     m_weaponDDI.clear();
+#ifndef GAME_DLL
+    m_nextDDISequence = 0;
+#endif
 }
 
 void WeaponStore::Reset_Weapon_Templates()
@@ -1891,7 +1946,11 @@ WeaponTemplate::~WeaponTemplate()
 
 void WeaponTemplate::Reset()
 {
+#ifdef GAME_DLL
     m_historicDamage.clear();
+#else
+    Clear_Historic_Damage();
+#endif
 }
 
 void WeaponTemplate::Parse_Weapon_Bonus_Set(INI *ini, void *formal, void *store, const void *user_data)
@@ -2051,6 +2110,20 @@ void WeaponTemplate::Trim_Old_Historic_Damage() const
     unsigned int frame = g_theGameLogic->Get_Frame() - g_theWriteableGlobalData->m_historicDamageLimit;
 
     while (m_historicDamage.size() != 0 && m_historicDamage.front().frame <= frame) {
+#ifndef GAME_DLL
+        const Coord3D &location = m_historicDamage.front().location;
+        float cell_size = m_historicBonusRadius + 1.0f;
+        auto cell = m_historicDamageCells.find(Get_Historic_Damage_Cell(
+            GameMath::Float_To_Int_Floor(location.x / cell_size), GameMath::Float_To_Int_Floor(location.y / cell_size)));
+
+        if (cell != m_historicDamageCells.end()) {
+            cell->second.pop_front();
+
+            if (cell->second.empty()) {
+                m_historicDamageCells.erase(cell);
+            }
+        }
+#endif
         m_historicDamage.pop_front();
     }
 }
@@ -2597,6 +2670,53 @@ bool Is_2D_Dist_Squared_Less_Than(const Coord3D *pos, const Coord3D *pos2, float
     return GameMath::Square(pos->x - pos2->x) + GameMath::Square(pos->y - pos2->y) <= dist_sqr;
 }
 
+#ifndef GAME_DLL
+void WeaponTemplate::Add_Historic_Damage(const HistoricWeaponDamageInfo &info) const
+{
+    // Cells are a little wider than the bonus radius so anything in range is always within the neighbouring cells.
+    float cell_size = m_historicBonusRadius + 1.0f;
+    m_historicDamage.push_back(info);
+    m_historicDamageCells[Get_Historic_Damage_Cell(GameMath::Float_To_Int_Floor(info.location.x / cell_size),
+                              GameMath::Float_To_Int_Floor(info.location.y / cell_size))]
+        .push_back(info);
+}
+
+void WeaponTemplate::Clear_Historic_Damage() const
+{
+    m_historicDamage.clear();
+    m_historicDamageCells.clear();
+}
+
+// Counts the historic damage at or after the given frame that is within the bonus radius of pos.
+int WeaponTemplate::Count_Historic_Damage(const Coord3D *pos, unsigned int frame) const
+{
+    float radius_sqr = m_historicBonusRadius * m_historicBonusRadius;
+    float cell_size = m_historicBonusRadius + 1.0f;
+    int cell_x = GameMath::Float_To_Int_Floor(pos->x / cell_size);
+    int cell_y = GameMath::Float_To_Int_Floor(pos->y / cell_size);
+    int count = 0;
+
+    for (int y = cell_y - 1; y <= cell_y + 1; y++) {
+        for (int x = cell_x - 1; x <= cell_x + 1; x++) {
+            auto cell = m_historicDamageCells.find(Get_Historic_Damage_Cell(x, y));
+
+            if (cell == m_historicDamageCells.end()) {
+                continue;
+            }
+
+            // Newest entries are at the back, stop at the first one that is too old.
+            for (auto it = cell->second.rbegin(); it != cell->second.rend() && it->frame >= frame; ++it) {
+                if (Is_2D_Dist_Squared_Less_Than(pos, &it->location, radius_sqr)) {
+                    count++;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+#endif
+
 void WeaponTemplate::Deal_Damage_Internal(ObjectID source_id,
     ObjectID victim_id,
     const Coord3D *pos,
@@ -2608,10 +2728,11 @@ void WeaponTemplate::Deal_Damage_Internal(ObjectID source_id,
         Trim_Old_Historic_Damage();
 
         if (m_historicBonusCount > 0 && m_historicBonusWeapon != this) {
-            float radius_sqr = m_historicBonusRadius * m_historicBonusRadius;
-            int count = 0;
             unsigned int frame = g_theGameLogic->Get_Frame();
             unsigned int frame2 = frame - m_historicBonusTime;
+#ifdef GAME_DLL
+            float radius_sqr = m_historicBonusRadius * m_historicBonusRadius;
+            int count = 0;
 
             for (auto it = m_historicDamage.begin(); it != m_historicDamage.end(); it++) {
                 if (it->frame >= frame2) {
@@ -2628,6 +2749,17 @@ void WeaponTemplate::Deal_Damage_Internal(ObjectID source_id,
                 g_theWeaponStore->Create_And_Fire_Temp_Weapon(m_historicBonusWeapon, source, pos);
                 m_historicDamage.clear();
             }
+#else
+            int count = Count_Historic_Damage(pos, frame2);
+
+            if (count < m_historicBonusCount - 1) {
+                HistoricWeaponDamageInfo info(frame, *pos);
+                Add_Historic_Damage(info);
+            } else {
+                g_theWeaponStore->Create_And_Fire_Temp_Weapon(m_historicBonusWeapon, source, pos);
+                Clear_Historic_Damage();
+            }
+#endif
         }
 
         Object *victim;
@@ -2658,6 +2790,11 @@ void WeaponTemplate::Deal_Damage_Internal(ObjectID source_id,
 
             float primary_radius_sqr = GameMath::Square(primary_radius);
             float max_radius = std::max(primary_radius, secondary_radius);
+            // These only depend on the weapon and the source's template, so work them out once per blast rather than
+            // once per object caught in it.
+            float angle = Get_Radius_Damage_Angle();
+            float cos_angle = GameMath::Cos(angle);
+            bool source_is_projectile = source != nullptr && source->Is_KindOf(KINDOF_PROJECTILE);
             SimpleObjectIterator *iter;
             float numeric;
             Object *target;
@@ -2691,7 +2828,6 @@ void WeaponTemplate::Deal_Damage_Internal(ObjectID source_id,
 
                 bool suicide = false;
                 DamageInfo info;
-                float angle;
                 Coord3D source_to_target_vec;
 
                 if (source != nullptr && target != victim) {
@@ -2749,8 +2885,6 @@ void WeaponTemplate::Deal_Damage_Internal(ObjectID source_id,
                     source_to_target_vec.Sub(source->Get_Position());
                 }
 
-                angle = Get_Radius_Damage_Angle();
-
                 if ((angle >= DEG_TO_RADF(180.0f) || target != nullptr) && source != nullptr) {
                     Vector3 source_forward_dir;
                     source->Get_Transform_Matrix()->Get_X_Vector(&source_forward_dir);
@@ -2758,7 +2892,7 @@ void WeaponTemplate::Deal_Damage_Internal(ObjectID source_id,
                     source_forward_dir.Normalize();
                     source_to_target_dir.Normalize();
 
-                    if (GameMath::Cos(angle) <= source_forward_dir * source_to_target_dir) {
+                    if (cos_angle <= source_forward_dir * source_to_target_dir) {
                         info.m_in.m_shockWaveAmount = m_shockWaveAmount;
 
                         if (info.m_in.m_shockWaveAmount > 0.0f) {
@@ -2787,7 +2921,7 @@ void WeaponTemplate::Deal_Damage_Internal(ObjectID source_id,
                             info.m_in.m_amount = 999999.0f;
                         }
 
-                        if (source != nullptr && source->Is_KindOf(KINDOF_PROJECTILE)) {
+                        if (source_is_projectile) {
                             ProjectileUpdateInterface *projectile = nullptr;
 
                             for (BehaviorModule **i = target->Get_All_Modules(); *i != nullptr; i++) {
@@ -22,11 +22,20 @@
 #include "gametype.h"
 #include "mempoolobj.h"
 #include "namekeygenerator.h"
+#include "rtsutils.h"
 #include "snapshot.h"
 #include "weaponset.h"
+#include <deque>
 #include <list>
+#include <map>
 #include <vector>
 
+#ifdef THYME_USE_STLPORT
+#include <hash_map>
+#else
+#include <unordered_map>
+#endif
+
 class FXList;
 class INI;
 class Object;
@@ -186,6 +195,24 @@ struct HistoricWeaponDamageInfo
     HistoricWeaponDamageInfo(unsigned int f, const Coord3D &loc) : frame(f), location(loc) {}
 };
 
+// Mixes both cell coordinates of a historic damage cell key so neighbouring cells spread over the buckets even where
+// size_t is 32 bits wide.
+struct HistoricDamageCellHash
+{
+    size_t operator()(uint64_t key) const
+    {
+        return static_cast<size_t>(static_cast<uint32_t>(key >> 32) * 73856093u ^ static_cast<uint32_t>(key) * 19349663u);
+    }
+};
+
+#ifdef THYME_USE_STLPORT
+using historicdamagecells_t =
+    std::hash_map<uint64_t, std::deque<HistoricWeaponDamageInfo>, HistoricDamageCellHash, std::equal_to<uint64_t>>;
+#else
+using historicdamagecells_t =
+    std::unordered_map<uint64_t, std::deque<HistoricWeaponDamageInfo>, HistoricDamageCellHash, std::equal_to<uint64_t>>;
+#endif
+
 class WeaponTemplate : public MemoryPoolObject
 {
     IMPLEMENT_POOL(WeaponTemplate);
@@ -204,6 +231,16 @@ public:
     bool Is_Contact_Weapon() const;
     void Trim_Old_Historic_Damage() const;
 
+#ifndef GAME_DLL
+    void Add_Historic_Damage(const HistoricWeaponDamageInfo &info) const;
+    void Clear_Historic_Damage() const;
+    int Count_Historic_Damage(const Coord3D *pos, unsigned int frame) const;
+    uint64_t Get_Historic_Damage_Cell(int x, int y) const
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    }
+#endif
+
     float Estimate_Weapon_Template_Damage(
         const Object *source_obj, const Object *victim_obj, const Coord3D *victim_pos, const WeaponBonus &bonus) const;
 
@@ -376,6 +413,11 @@ private:
     unsigned int m_suspendFXDelay;
     bool m_missileCallsOnDie;
     mutable std::list<HistoricWeaponDamageInfo> m_historicDamage;
+#ifndef GAME_DLL
+    // The entries of m_historicDamage bucketed into cells at least m_historicBonusRadius across, each cell kept in the
+    // same time order as the list so trimming the list front also trims the front of the entry's cell.
+    mutable historicdamagecells_t m_historicDamageCells;
+#endif
 
     static FieldParse s_fieldParseTable[];
     friend class WeaponStore;
@@ -574,6 +616,9 @@ public:
         ObjectID m_delaySourceID;
         ObjectID m_delayIntendedVictimID;
         WeaponBonus m_bonus;
+#ifndef GAME_DLL
+        unsigned int m_sequence;
+#endif
     };
 
 #ifdef GAME_DLL
@@ -614,8 +659,24 @@ public:
     static void Parse_Weapon_Template_Definition(INI *ini);
 
 private:
+#ifdef THYME_USE_STLPORT
+    typedef std::hash_map<NameKeyType, WeaponTemplate *, rts::hash<NameKeyType>, std::equal_to<NameKeyType>>
+        weapontemplatemap_t;
+#else
+    typedef std::unordered_map<NameKeyType, WeaponTemplate *, rts::hash<NameKeyType>, std::equal_to<NameKeyType>>
+        weapontemplatemap_t;
+#endif
+
     std::vector<WeaponTemplate *> m_weaponTemplateVector;
+#ifdef GAME_DLL
     std::list<WeaponDelayedDamageInfo> m_weaponDDI;
+#else
+    // Delayed damage bucketed by the frame it is due on so Update only looks at entries that are due. Entries carry a
+    // sequence number so damage due at the same time is still dealt in the order it was queued.
+    std::map<unsigned int, std::list<WeaponDelayedDamageInfo>> m_weaponDDI;
+    unsigned int m_nextDDISequence = 0;
+    weapontemplatemap_t m_weaponTemplateMap;
+#endif
 };
 
 #ifdef GAME_DLL
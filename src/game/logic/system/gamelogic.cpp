@@ -315,6 +315,16 @@ Object *GameLogic::Get_First_Object()
     return m_objList;
 }
 
+#ifndef GAME_DLL
+// Called when an object gains a disabled state so the end of frame disabled check knows to look at it.
+void GameLogic::Note_Object_Disabled(Object *obj)
+{
+    if (obj->Get_List_Sequence() != 0) {
+        m_disabledObjects[obj->Get_List_Sequence()] = obj;
+    }
+}
+#endif
+
 ObjectID GameLogic::Allocate_Object_ID()
 {
     ObjectID id = m_nextObjID;
@@ -500,14 +510,28 @@ void GameLogic::Register_Object(Object *obj)
 {
     obj->Prepend_To_List(&m_objList);
     Add_Object_To_Lookup_Table(obj);
+#ifndef GAME_DLL
+    obj->Set_List_Sequence(++m_nextListSequence);
+
+    if (obj->Is_Disabled()) {
+        Note_Object_Disabled(obj);
+    }
+#endif
     unsigned int frame = g_theGameLogic->Get_Frame();
 
     if (frame == 0) {
         frame = 1;
     }
 
+#ifdef GAME_DLL
     for (BehaviorModule **module = obj->Get_All_Modules(); *module != nullptr; module++) {
         UpdateModuleInterface *update_interface = (*module)->Get_Update();
+#else
+    const ModuleDispatchTable *dispatch = obj->Get_Module_Dispatch_Table();
+
+    for (auto i = dispatch->update.begin(); i != dispatch->update.end(); ++i) {
+        UpdateModuleInterface *update_interface = obj->Get_All_Modules()[*i]->Get_Update();
+#endif
         UpdateModule *update;
 
         if (update_interface != nullptr) {
@@ -915,6 +939,9 @@ void GameLogic::Reset()
     m_controlBarOverrides.clear();
     m_objectLookupTable.clear();
     m_objectLookupTable.resize(0x2000);
+#ifndef GAME_DLL
+    m_disabledObjects.clear();
+#endif
     m_gamePaused = false;
     m_inputEnabled = true;
     m_mouseVisible = true;
@@ -1079,11 +1106,30 @@ void GameLogic::Update()
 
     // obsolete copy protection code removed
 
+#ifdef GAME_DLL
     for (Object *obj = m_objList; obj != nullptr; obj = obj->Get_Next_Object()) {
         if (obj->Is_Disabled()) {
             obj->Check_Disabled_Status();
         }
     }
+#else
+    // Only visit objects that may be disabled. Looking up the next entry after each check keeps the list order and picks
+    // up objects further down the list that become disabled during the pass, just as walking the list would.
+    for (auto it = m_disabledObjects.begin(); it != m_disabledObjects.end();) {
+        unsigned int sequence = it->first;
+        Object *obj = it->second;
+
+        if (obj->Is_Disabled()) {
+            obj->Check_Disabled_Status();
+        }
+
+        if (!obj->Is_Disabled()) {
+            m_disabledObjects.erase(sequence);
+        }
+
+        it = m_disabledObjects.upper_bound(sequence);
+    }
+#endif
 
     if (!m_startNewGame) {
         m_frame++;
@@ -1168,6 +1214,9 @@ void GameLogic::Process_Destroy_List()
 
         obj->Remove_From_List(&m_objList);
         Remove_Object_From_Lookup_Table(obj);
+#ifndef GAME_DLL
+        m_disabledObjects.erase(obj->Get_List_Sequence());
+#endif
         obj->Delete();
     }
 
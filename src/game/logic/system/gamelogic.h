@@ -188,6 +188,9 @@ public:
     unsigned int Get_Object_Count();
     void Prepare_Logic_For_Object_Load();
     Object *Get_First_Object();
+#ifndef GAME_DLL
+    void Note_Object_Disabled(Object *obj);
+#endif
 
     void Erase_Sleepy_Update(int index);
     int Rebalance_Parent_Sleepy_Update(int index);
@@ -255,6 +258,12 @@ private:
 #endif
     int m_frameTriggerAreasChanged;
     std::list<ObjectTOCEntry> m_objectTOCEntries;
+#ifndef GAME_DLL
+    // Objects that may have a disabled state, keyed by when they were put in the object list. The list is built by
+    // prepending so walking this newest first visits them in list order.
+    std::map<unsigned int, Object *, std::greater<unsigned int>> m_disabledObjects;
+    unsigned int m_nextListSequence = 0;
+#endif
 };
 
 #ifdef GAME_DLL
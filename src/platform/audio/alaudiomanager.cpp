@@ -20,6 +20,7 @@
 #include "globaldata.h"
 #include "playingaudio.h"
 #include "videoplayer.h"
+#include <algorithm>
 
 namespace Thyme
 {
@@ -553,27 +554,13 @@ bool ALAudioManager::Does_Violate_Limit(AudioEventRTS *event) const
 
     int playing_matches = 0;
     int request_matches = 0;
+    const PlayingSampleIndex &index = event->Is_Positional_Audio() ? m_positionalIndex : m_globalIndex;
+    auto found = index.events.find(event->Get_Event_Name());
 
-    if (event->Is_Positional_Audio()) {
-        for (auto it = m_positionalAudioList.begin(); it != m_positionalAudioList.end(); ++it) {
-            if (event->Get_Event_Name() == (*it)->openal.audio_event->Get_Event_Name()) {
-                if (playing_matches == 0) {
-                    event->Set_Handle_To_Kill((*it)->openal.audio_event->Get_Playing_Handle());
-                }
-
-                ++playing_matches;
-            }
-        }
-    } else {
-        for (auto it = m_globalAudioList.begin(); it != m_globalAudioList.end(); ++it) {
-            if (event->Get_Event_Name() == (*it)->openal.audio_event->Get_Event_Name()) {
-                if (playing_matches == 0) {
-                    event->Set_Handle_To_Kill((*it)->openal.audio_event->Get_Playing_Handle());
-                }
-
-                ++playing_matches;
-            }
-        }
+    if (found != index.events.end() && !found->second.empty()) {
+        // The oldest instance of the event is the one to kill if it needs to make room.
+        event->Set_Handle_To_Kill(found->second.front()->openal.audio_event->Get_Playing_Handle());
+        playing_matches = static_cast<int>(found->second.size());
     }
 
     for (auto it = m_audioRequestList.begin(); it != m_audioRequestList.end(); ++it) {
@@ -611,18 +598,10 @@ bool ALAudioManager::Is_Playing_Lower_Priority(AudioEventRTS *event) const
         return false;
     }
 
-    if (event->Is_Positional_Audio()) {
-        for (auto it = m_positionalAudioList.begin(); it != m_positionalAudioList.end(); ++it) {
-            if ((*it)->openal.audio_event->Get_Event_Info()->Get_Priority() < priority) {
-                return true;
-            }
-        }
+    const PlayingSampleIndex &index = event->Is_Positional_Audio() ? m_positionalIndex : m_globalIndex;
 
-        return false;
-    }
-
-    for (auto it = m_globalAudioList.begin(); it != m_globalAudioList.end(); ++it) {
-        if ((*it)->openal.audio_event->Get_Event_Info()->Get_Priority() < priority) {
+    for (int i = 0; i < priority && i < PRIORITY_COUNT; ++i) {
+        if (index.priorities[i] != 0) {
             return true;
         }
     }
@@ -635,23 +614,10 @@ bool ALAudioManager::Is_Playing_Lower_Priority(AudioEventRTS *event) const
  */
 bool ALAudioManager::Is_Playing_Already(AudioEventRTS *event) const
 {
-    if (event->Is_Positional_Audio()) {
-        for (auto it = m_positionalAudioList.begin(); it != m_positionalAudioList.end(); ++it) {
-            if ((*it)->openal.audio_event->Get_Event_Name() == event->Get_Event_Name()) {
-                return true;
-            }
-        }
-
-        return false;
-    }
+    const PlayingSampleIndex &index = event->Is_Positional_Audio() ? m_positionalIndex : m_globalIndex;
+    auto found = index.events.find(event->Get_Event_Name());
 
-    for (auto it = m_globalAudioList.begin(); it != m_globalAudioList.end(); ++it) {
-        if ((*it)->openal.audio_event->Get_Event_Name() == event->Get_Event_Name()) {
-            return true;
-        }
-    }
-
-    return false;
+    return found != index.events.end() && !found->second.empty();
 }
 
 /**
@@ -663,21 +629,7 @@ bool ALAudioManager::Is_Object_Playing_Voice(unsigned obj) const
         return false;
     }
 
-    for (auto it = m_globalAudioList.begin(); it != m_globalAudioList.end(); ++it) {
-        if ((*it)->openal.audio_event->Get_Object_ID() == obj
-            && ((*it)->openal.audio_event->Get_Event_Info()->Get_Visibility() & VISIBILITY_VOICE)) {
-            return true;
-        }
-    }
-
-    for (auto it = m_positionalAudioList.begin(); it != m_positionalAudioList.end(); ++it) {
-        if ((*it)->openal.audio_event->Get_Object_ID() == obj
-            && ((*it)->openal.audio_event->Get_Event_Info()->Get_Visibility() & VISIBILITY_VOICE)) {
-            return true;
-        }
-    }
-
-    return false;
+    return m_voiceObjects.find(obj) != m_voiceObjects.end();
 }
 
 /**
@@ -908,6 +860,34 @@ void ALAudioManager::Set_Preferred_Speaker(Utf8String speaker)
     m_preferredSpeaker = speaker;
 }
 
+/**
+ * Decodes the samples an event can play into the file cache so first playback doesn't have to hit the disk. Returns false
+ * once a sample no longer fits, further prefetching would only evict samples prefetched earlier.
+ */
+bool ALAudioManager::Prefetch_Audio_Event(Utf8String event)
+{
+#ifdef BUILD_WITH_FFMPEG
+    AudioEventInfo *info = Find_Audio_Event_Info(event);
+
+    if (info == nullptr) {
+        return true;
+    }
+
+    AudioEventRTS audio_event;
+    std::vector<Utf8String> filenames;
+    audio_event.Set_Event_Info(info);
+    audio_event.Generate_All_Sample_Filenames(filenames);
+
+    for (const Utf8String &filename : filenames) {
+        if (m_audioFileCache->Prefetch_File(filename) == PREFETCH_CACHE_FULL) {
+            return false;
+        }
+    }
+#endif
+
+    return true;
+}
+
 /**
  * Gets the files length in milliseconds.
  */
@@ -1143,6 +1123,10 @@ void ALAudioManager::Process_Stopped_List()
  */
 void ALAudioManager::Release_Playing_Audio(PlayingAudio *audio)
 {
+    if (audio->openal.playing_type == PAT_2DSAMPLE || audio->openal.playing_type == PAT_3DSAMPLE) {
+        Remove_Sample_From_Index(audio);
+    }
+
     if (audio->openal.audio_event->Get_Event_Info()->Get_Event_Type() == EVENT_SOUND) {
         switch (audio->openal.playing_type) {
             case PAT_2DSAMPLE:
@@ -1168,6 +1152,58 @@ void ALAudioManager::Release_Playing_Audio(PlayingAudio *audio)
     delete audio;
 }
 
+/**
+ * Records a sample that has been added to one of the playing lists.
+ */
+void ALAudioManager::Add_Sample_To_Index(PlayingAudio *audio)
+{
+    AudioEventRTS *event = audio->openal.audio_event;
+    const AudioEventInfo *info = event->Get_Event_Info();
+    PlayingSampleIndex &index = audio->openal.playing_type == PAT_3DSAMPLE ? m_positionalIndex : m_globalIndex;
+
+    // Snapshot the keys that could change while playing so removal matches what was added.
+    audio->openal.indexed_priority = std::clamp(info->Get_Priority(), 0, PRIORITY_COUNT - 1);
+    audio->openal.voice_object = (info->Get_Visibility() & VISIBILITY_VOICE) ? event->Get_Object_ID() : 0;
+
+    index.events[event->Get_Event_Name()].push_back(audio);
+    ++index.priorities[audio->openal.indexed_priority];
+
+    if (audio->openal.voice_object != 0) {
+        ++m_voiceObjects[audio->openal.voice_object];
+    }
+}
+
+/**
+ * Forgets a sample that is being removed from the playing lists.
+ */
+void ALAudioManager::Remove_Sample_From_Index(PlayingAudio *audio)
+{
+    PlayingSampleIndex &index = audio->openal.playing_type == PAT_3DSAMPLE ? m_positionalIndex : m_globalIndex;
+    auto found = index.events.find(audio->openal.audio_event->Get_Event_Name());
+
+    if (found != index.events.end()) {
+        auto it = std::find(found->second.begin(), found->second.end(), audio);
+
+        if (it != found->second.end()) {
+            found->second.erase(it);
+        }
+
+        if (found->second.empty()) {
+            index.events.erase(found);
+        }
+    }
+
+    --index.priorities[audio->openal.indexed_priority];
+
+    if (audio->openal.voice_object != 0) {
+        auto voice = m_voiceObjects.find(audio->openal.voice_object);
+
+        if (voice != m_voiceObjects.end() && --voice->second == 0) {
+            m_voiceObjects.erase(voice);
+        }
+    }
+}
+
 /**
  * Stops the playing audio sample.
  */
@@ -1441,6 +1477,7 @@ void ALAudioManager::Play_Audio_Event(AudioEventRTS *event)
                 pa->openal.playing_type = PAT_3DSAMPLE;
                 pa->openal.file_handle = nullptr;
                 m_positionalAudioList.push_back(pa);
+                Add_Sample_To_Index(pa);
 
                 if (source_handle != 0) {
                     pa->openal.file_handle = Play_Sample3D(event, pa);
@@ -1478,6 +1515,7 @@ void ALAudioManager::Play_Audio_Event(AudioEventRTS *event)
                 pa->openal.playing_type = PAT_2DSAMPLE;
                 pa->openal.file_handle = nullptr;
                 m_globalAudioList.push_back(pa);
+                Add_Sample_To_Index(pa);
 
                 if (source_handle != 0) {
                     pa->openal.file_handle = Play_Sample2D(event, pa);
@@ -1720,6 +1758,8 @@ void ALAudioManager::Init_Playing_Audio(PlayingAudio *audio)
         audio->openal.disable_loops = false;
         audio->openal.release_event = true;
         audio->openal.time_fading = 0;
+        audio->openal.indexed_priority = 0;
+        audio->openal.voice_object = 0;
     }
 }
 
@@ -16,7 +16,16 @@
 
 #include "always.h"
 #include "audiomanager.h"
+#include "gametype.h"
+#include "rtsutils.h"
 #include <new>
+#include <vector>
+
+#ifdef THYME_USE_STLPORT
+#include <hash_map>
+#else
+#include <unordered_map>
+#endif
 
 #ifdef BUILD_WITH_FFMPEG
 #include "ffmpegaudiofilecache.h"
@@ -35,6 +44,16 @@ struct PlayingAudio;
 
 namespace Thyme
 {
+#ifdef THYME_USE_STLPORT
+typedef std::hash_map<const Utf8String, std::vector<PlayingAudio *>, rts::hash<Utf8String>, std::equal_to<Utf8String>>
+    playingeventmap_t;
+typedef std::hash_map<unsigned, int> playingvoicemap_t;
+#else
+typedef std::unordered_map<const Utf8String, std::vector<PlayingAudio *>, rts::hash<Utf8String>, std::equal_to<Utf8String>>
+    playingeventmap_t;
+typedef std::unordered_map<unsigned, int> playingvoicemap_t;
+#endif
+
 class ALAudioStream;
 class ALAudioManager final : public AudioManager
 {
@@ -97,6 +116,7 @@ public:
     virtual void Process_Playing_List() override;
     virtual void Process_Fading_List() override;
     virtual void Process_Stopped_List() override;
+    virtual bool Prefetch_Audio_Event(Utf8String event) override;
 
     bool Is_Device_Open() const { return m_alcDevice != nullptr; }
     bool Supports_Float_Samples() const { return alIsExtensionPresent("AL_EXT_float32") == AL_TRUE; }
@@ -134,9 +154,20 @@ private:
     void Enumerate_Devices();
     bool Check_ALC_Error();
 
+    void Add_Sample_To_Index(PlayingAudio *audio);
+    void Remove_Sample_From_Index(PlayingAudio *audio);
+
     static void Init_Playing_Audio(PlayingAudio *audio);
 
 private:
+    // Samples in one of the playing lists grouped by event name in play order and counted by priority, kept up to date
+    // as samples start and stop so the limit checks don't have to walk the lists for every request.
+    struct PlayingSampleIndex
+    {
+        playingeventmap_t events;
+        int priorities[PRIORITY_COUNT] = {};
+    };
+
     Utf8String m_alDevicesList[AL_MAX_PLAYBACK_DEVICES];
     int m_alMaxDevicesIndex;
 
@@ -148,6 +179,9 @@ private:
     std::list<PlayingAudio *> m_streamList;
     std::list<PlayingAudio *> m_fadingList;
     std::list<PlayingAudio *> m_stoppedList;
+    PlayingSampleIndex m_globalIndex;
+    PlayingSampleIndex m_positionalIndex;
+    playingvoicemap_t m_voiceObjects;
 #ifdef BUILD_WITH_FFMPEG
     Thyme::FFmpegAudioFileCache *m_audioFileCache;
 #endif
@@ -21,8 +21,10 @@ extern "C" {
 #include "audiomanager.h"
 #include "ffmpegaudiofilecache.h"
 #include "filesystem.h"
+#include <algorithm>
 #include <captainslog.h>
 #include <list>
+#include <vector>
 
 namespace Thyme
 {
@@ -62,8 +64,14 @@ bool FFmpegAudioFileCache::Decode_FFmpeg(FFmpegOpenAudioFile *file)
     auto on_frame = [](AVFrame *frame, int stream_idx, int stream_type, void *user_data) {
         FFmpegOpenAudioFile *file = static_cast<FFmpegOpenAudioFile *>(user_data);
         if (stream_type != AVMEDIA_TYPE_AUDIO) {
-            captainslog_warn(
-                "Skipping non-audio data inside audioevent: %s", file->audio_event_info->Get_Event_Name().Str());
+            // Prefetched files are decoded before any event references them.
+            if (file->audio_event_info != nullptr) {
+                captainslog_warn(
+                    "Skipping non-audio data inside audioevent: %s", file->audio_event_info->Get_Event_Name().Str());
+            } else {
+                captainslog_warn("Skipping non-audio data inside audio file");
+            }
+
             return;
         }
 
@@ -73,7 +81,14 @@ bool FFmpegAudioFileCache::Decode_FFmpeg(FFmpegOpenAudioFile *file)
         }
 
         const int frame_data_size = file->ffmpeg_file->Get_Size_For_Samples(frame->nb_samples);
-        file->wave_data = static_cast<uint8_t *>(av_realloc(file->wave_data, file->data_size + frame_data_size));
+        const int required = file->data_size + frame_data_size;
+
+        // Grow geometrically so long files aren't copied again for every decoded frame.
+        if (required > file->data_capacity) {
+            file->data_capacity = std::max(required, file->data_capacity * 2);
+            file->wave_data = static_cast<uint8_t *>(av_realloc(file->wave_data, file->data_capacity));
+        }
+
         memcpy(file->wave_data + file->data_size, frame->data[0], frame_data_size);
         file->data_size += frame_data_size;
         file->total_samples += frame->nb_samples;
@@ -86,6 +101,12 @@ bool FFmpegAudioFileCache::Decode_FFmpeg(FFmpegOpenAudioFile *file)
     while (file->ffmpeg_file->Decode_Packet()) {
     }
 
+    // Give back the slack left over from growing the buffer.
+    if (file->data_capacity > file->data_size) {
+        file->wave_data = static_cast<uint8_t *>(av_realloc(file->wave_data, file->data_size));
+        file->data_capacity = file->data_size;
+    }
+
     // Calculate the duration in MS
     file->duration = (file->total_samples / (float)file->ffmpeg_file->Get_Sample_Rate()) * 1000.0f;
 
@@ -138,42 +159,17 @@ AudioDataHandle FFmpegAudioFileCache::Open_File(const Utf8String &filename)
 
     if (it != m_cacheMap.end()) {
         ++(it->second.ref_count);
+        it->second.last_used = ++m_useCounter;
 
         return static_cast<AudioDataHandle>(it->second.wave_data);
     }
 
-    // Load the file from disk
-    File *file = g_theFileSystem->Open_File(filename.Str(), File::READ | File::BINARY | File::BUFFERED);
-
-    if (file == nullptr) {
-        if (filename.Is_Not_Empty()) {
-            captainslog_warn("Missing audio file '%s', could not cache.", filename.Str());
-        }
-
-        return nullptr;
-    }
-
     FFmpegOpenAudioFile open_audio;
-    open_audio.wave_data = static_cast<uint8_t *>(av_malloc(sizeof(WavHeader)));
-    open_audio.data_size = sizeof(WavHeader);
-    open_audio.ffmpeg_file = new FFmpegFile();
 
-    // This transfer ownership of file
-    if (!open_audio.ffmpeg_file->Open(file)) {
-        captainslog_warn("Failed to load audio file '%s', could not cache.", filename.Str());
-        Release_Open_Audio(&open_audio);
+    if (!Load_File(filename, &open_audio)) {
         return nullptr;
     }
 
-    if (!Decode_FFmpeg(&open_audio)) {
-        captainslog_warn("Failed to decode audio file '%s', could not cache.", filename.Str());
-        Release_Open_Audio(&open_audio);
-        return nullptr;
-    }
-
-    Fill_Wave_Data(&open_audio);
-    open_audio.ffmpeg_file->Close();
-
     open_audio.ref_count = 1;
     m_currentSize += open_audio.data_size;
 
@@ -186,10 +182,57 @@ AudioDataHandle FFmpegAudioFileCache::Open_File(const Utf8String &filename)
         return nullptr;
     }
 
+    open_audio.last_used = ++m_useCounter;
     m_cacheMap[filename] = open_audio;
 
     return static_cast<AudioDataHandle>(open_audio.wave_data);
 }
+
+/**
+ * Decodes an audio file ahead of playback so the first Open_File call for it is a cache hit. Only unreferenced samples
+ * are evicted to make room, and only when enough of them can go for the file to fit.
+ */
+PrefetchResult FFmpegAudioFileCache::Prefetch_File(const Utf8String &filename)
+{
+    ScopedMutexClass lock(&m_mutex);
+
+    auto it = m_cacheMap.find(filename);
+
+    if (it != m_cacheMap.end()) {
+        it->second.last_used = ++m_useCounter;
+
+        return PREFETCH_LOADED;
+    }
+
+    FFmpegOpenAudioFile open_audio;
+
+    if (!Load_File(filename, &open_audio)) {
+        return PREFETCH_FAILED;
+    }
+
+    unsigned new_size = m_currentSize + open_audio.data_size;
+
+    // Prefetched samples have no event info to compare priorities against, so only unreferenced samples can make room.
+    if (new_size > m_maxSize) {
+        unsigned required = new_size - m_maxSize;
+
+        if (Get_Unreferenced_Size() < required) {
+            captainslog_debug("Not prefetching audio file since cache is full: %s", filename.Str());
+            Release_Open_Audio(&open_audio);
+
+            return PREFETCH_CACHE_FULL;
+        }
+
+        Free_Space(required);
+    }
+
+    m_currentSize += open_audio.data_size;
+    open_audio.last_used = ++m_useCounter;
+    m_cacheMap[filename] = open_audio;
+
+    return PREFETCH_LOADED;
+}
+
 /**
  * Opens an audio file for an event. Reads from the cache if available or loads from file if not.
  */
@@ -221,47 +264,33 @@ AudioDataHandle FFmpegAudioFileCache::Open_File(AudioEventRTS *audio_event)
     auto it = m_cacheMap.find(filename);
 
     if (it != m_cacheMap.end()) {
-        ++(it->second.ref_count);
-
-        return static_cast<AudioDataHandle>(it->second.wave_data);
-    }
-
-    // Load the file from disk
-    File *file = g_theFileSystem->Open_File(filename.Str(), File::READ | File::BINARY | File::BUFFERED);
+        // Prefetched entries have no event yet, so the first event to use them has to pass the same checks as a load.
+        if (it->second.audio_event_info == nullptr) {
+            if (!Is_Valid_For_Event(it->second, audio_event)) {
+                return nullptr;
+            }
 
-    if (file == nullptr) {
-        if (!filename.Is_Empty()) {
-            captainslog_warn("Missing audio file '%s', could not cache.", filename.Str());
+            it->second.audio_event_info = audio_event->Get_Event_Info();
         }
 
-        return nullptr;
+        ++(it->second.ref_count);
+        it->second.last_used = ++m_useCounter;
+
+        return static_cast<AudioDataHandle>(it->second.wave_data);
     }
 
     FFmpegOpenAudioFile open_audio;
-    open_audio.wave_data = static_cast<uint8_t *>(av_malloc(sizeof(WavHeader)));
-    open_audio.data_size = sizeof(WavHeader);
-    open_audio.audio_event_info = audio_event->Get_Event_Info();
-    open_audio.ffmpeg_file = new FFmpegFile();
 
-    if (!open_audio.ffmpeg_file->Open(file)) {
-        captainslog_warn("Failed to load audio file '%s', could not cache.", filename.Str());
+    if (!Load_File(filename, &open_audio)) {
         return nullptr;
     }
 
-    if (audio_event->Is_Positional_Audio() && open_audio.ffmpeg_file->Get_Num_Channels() > 1) {
-        captainslog_error("Audio marked as positional audio cannot have more than one channel.");
-        return nullptr;
-    }
-
-    if (!Decode_FFmpeg(&open_audio)) {
-        captainslog_warn("Failed to decode audio file '%s', could not cache.", filename.Str());
-        open_audio.ffmpeg_file->Close();
+    if (!Is_Valid_For_Event(open_audio, audio_event)) {
+        Release_Open_Audio(&open_audio);
         return nullptr;
     }
 
-    Fill_Wave_Data(&open_audio);
-    open_audio.ffmpeg_file->Close();
-
+    open_audio.audio_event_info = audio_event->Get_Event_Info();
     open_audio.ref_count = 1;
     m_currentSize += open_audio.data_size;
 
@@ -274,11 +303,66 @@ AudioDataHandle FFmpegAudioFileCache::Open_File(AudioEventRTS *audio_event)
         return nullptr;
     }
 
+    open_audio.last_used = ++m_useCounter;
     m_cacheMap[filename] = open_audio;
 
     return static_cast<AudioDataHandle>(open_audio.wave_data);
 }
 
+/**
+ * Loads and decodes an audio file from disk into an unreferenced cache entry.
+ */
+bool FFmpegAudioFileCache::Load_File(const Utf8String &filename, FFmpegOpenAudioFile *open_audio)
+{
+    File *file = g_theFileSystem->Open_File(filename.Str(), File::READ | File::BINARY | File::BUFFERED);
+
+    if (file == nullptr) {
+        if (filename.Is_Not_Empty()) {
+            captainslog_warn("Missing audio file '%s', could not cache.", filename.Str());
+        }
+
+        return false;
+    }
+
+    open_audio->wave_data = static_cast<uint8_t *>(av_malloc(sizeof(WavHeader)));
+    open_audio->data_size = sizeof(WavHeader);
+    open_audio->data_capacity = sizeof(WavHeader);
+    open_audio->ffmpeg_file = new FFmpegFile();
+
+    // This transfer ownership of file
+    if (!open_audio->ffmpeg_file->Open(file)) {
+        captainslog_warn("Failed to load audio file '%s', could not cache.", filename.Str());
+        Release_Open_Audio(open_audio);
+        return false;
+    }
+
+    if (!Decode_FFmpeg(open_audio)) {
+        captainslog_warn("Failed to decode audio file '%s', could not cache.", filename.Str());
+        Release_Open_Audio(open_audio);
+        return false;
+    }
+
+    Fill_Wave_Data(open_audio);
+    open_audio->ffmpeg_file->Close();
+
+    return true;
+}
+
+/**
+ * Checks that decoded audio data can be played by an event.
+ */
+bool FFmpegAudioFileCache::Is_Valid_For_Event(const FFmpegOpenAudioFile &open_audio, AudioEventRTS *audio_event)
+{
+    const WavHeader *header = reinterpret_cast<const WavHeader *>(open_audio.wave_data);
+
+    if (audio_event->Is_Positional_Audio() && header->channels > 1) {
+        captainslog_error("Audio marked as positional audio cannot have more than one channel.");
+        return false;
+    }
+
+    return true;
+}
+
 /**
  * Closes a file, reducing the references to it. Does not actually free the cache.
  */
@@ -333,19 +417,31 @@ void FFmpegAudioFileCache::Set_Max_Size(unsigned size)
  */
 unsigned FFmpegAudioFileCache::Free_Space(unsigned required)
 {
+    std::vector<const ffmpegaudiocachemap_t::value_type *> candidates;
     std::list<Utf8String> to_free;
     unsigned freed = 0;
 
     // First check for samples that don't have any references.
     for (const auto &cached : m_cacheMap) {
         if (cached.second.ref_count == 0) {
-            to_free.push_back(cached.first);
-            freed += cached.second.data_size;
+            candidates.push_back(&cached);
+        }
+    }
 
-            // If required is "0" we free as much as possible
-            if (required && freed >= required) {
-                break;
-            }
+    // Release the least recently used samples first.
+    std::sort(candidates.begin(),
+        candidates.end(),
+        [](const ffmpegaudiocachemap_t::value_type *a, const ffmpegaudiocachemap_t::value_type *b) {
+            return a->second.last_used < b->second.last_used;
+        });
+
+    for (const auto *cached : candidates) {
+        to_free.push_back(cached->first);
+        freed += cached->second.data_size;
+
+        // If required is "0" we free as much as possible
+        if (required && freed >= required) {
+            break;
         }
     }
 
@@ -362,6 +458,22 @@ unsigned FFmpegAudioFileCache::Free_Space(unsigned required)
     return freed;
 }
 
+/**
+ * Gets the number of bytes Free_Space could release.
+ */
+unsigned FFmpegAudioFileCache::Get_Unreferenced_Size() const
+{
+    unsigned size = 0;
+
+    for (const auto &cached : m_cacheMap) {
+        if (cached.second.ref_count == 0) {
+            size += cached.second.data_size;
+        }
+    }
+
+    return size;
+}
+
 /**
  * Attempts to free space for a file by releasing files with no references and lower priority sounds.
  */
@@ -375,10 +487,11 @@ bool FFmpegAudioFileCache::Free_Space_For_Sample(const FFmpegOpenAudioFile &file
     // First check for samples that don't have any references.
     freed = Free_Space(required);
 
-    // If we still don't have enough potential space freed up, look for lower priority sounds to remove.
-    if (freed < required) {
+    // If we still don't have enough potential space freed up, look for lower priority sounds to remove. Entries without
+    // event info have no priority to compare against, so they are never displaced this way and can't displace others.
+    if (freed < required && file.audio_event_info != nullptr) {
         for (const auto &cached : m_cacheMap) {
-            if (cached.second.ref_count != 0
+            if (cached.second.ref_count != 0 && cached.second.audio_event_info != nullptr
                 && cached.second.audio_event_info->Get_Priority() < file.audio_event_info->Get_Priority()) {
                 to_free.push_back(cached.first);
                 freed += cached.second.data_size;
@@ -44,8 +44,10 @@ struct FFmpegOpenAudioFile
     float duration = 0.0f;
     int ref_count = 0;
     int data_size = 0;
+    int data_capacity = 0;
     const AudioEventInfo *audio_event_info = nullptr;
     int total_samples = 0;
+    unsigned last_used = 0;
 };
 
 #ifdef THYME_USE_STLPORT
@@ -56,13 +58,21 @@ typedef std::unordered_map<const Utf8String, FFmpegOpenAudioFile, rts::hash<Utf8
     ffmpegaudiocachemap_t;
 #endif
 
+enum PrefetchResult
+{
+    PREFETCH_LOADED,
+    PREFETCH_FAILED,
+    PREFETCH_CACHE_FULL,
+};
+
 class FFmpegAudioFileCache
 {
 public:
-    FFmpegAudioFileCache() : m_currentSize(0), m_maxSize(0), m_mutex("AudioFileCacheMutex") {}
+    FFmpegAudioFileCache() : m_currentSize(0), m_maxSize(0), m_useCounter(0), m_mutex("AudioFileCacheMutex") {}
     virtual ~FFmpegAudioFileCache();
     AudioDataHandle Open_File(AudioEventRTS *file);
     AudioDataHandle Open_File(const Utf8String &filename);
+    PrefetchResult Prefetch_File(const Utf8String &filename);
 
     void Close_File(AudioDataHandle file);
     void Set_Max_Size(unsigned size);
@@ -86,7 +96,10 @@ public:
 
 private:
     bool Free_Space_For_Sample(const FFmpegOpenAudioFile &open_audio);
+    unsigned Get_Unreferenced_Size() const;
     void Release_Open_Audio(FFmpegOpenAudioFile *open_audio);
+    bool Load_File(const Utf8String &filename, FFmpegOpenAudioFile *open_audio);
+    static bool Is_Valid_For_Event(const FFmpegOpenAudioFile &open_audio, AudioEventRTS *audio_event);
 
     // FFmpeg utilities
     static bool Decode_FFmpeg(FFmpegOpenAudioFile *open_audio);
@@ -95,6 +108,7 @@ private:
     ffmpegaudiocachemap_t m_cacheMap;
     unsigned m_currentSize;
     unsigned m_maxSize;
+    unsigned m_useCounter;
     mutable SimpleMutexClass m_mutex;
 };
 } // namespace Thyme
@@ -58,6 +58,9 @@ struct OpenALPlayingAudio
     bool disable_loops;
     bool release_event;
     int time_fading;
+    // Keys the sample was counted under while in the playing lists.
+    int indexed_priority;
+    unsigned voice_object;
 };
 #endif
 
@@ -1,5 +1,6 @@
 extern "C" {
 #include <libavcodec/avcodec.h>
+#include <libavutil/time.h>
 #include <libswscale/swscale.h>
 }
 
@@ -13,6 +14,7 @@ extern "C" {
 #include "alaudiostream.h"
 #endif
 
+#include <algorithm>
 #include <captainslog.h>
 
 namespace Thyme
@@ -27,11 +29,11 @@ FFmpegVideoStream::FFmpegVideoStream(VideoPlayer *player, VideoStream *next, FFm
         m_audioStream = new ALAudioStream();
 #endif
     m_next = next;
+    // Decoded frames are referenced into this one frame rather than cloning a new one each time.
+    m_frame = av_frame_alloc();
     file->Set_Frame_Callback(On_Frame);
     file->Set_User_Data(this);
-    // Decode until we have our first video frame
-    while (m_good && m_gotFrame == false)
-        m_good = m_ffmpegFile->Decode_Packet();
+    Decode_Next_Frame();
 
     m_startTime = rts::Get_Time();
 #ifdef BUILD_WITH_OPENAL
@@ -56,8 +58,13 @@ void FFmpegVideoStream::On_Frame(AVFrame *frame, int stream_idx, int stream_type
 {
     FFmpegVideoStream *video_stream = static_cast<FFmpegVideoStream *>(user_data);
     if (stream_type == AVMEDIA_TYPE_VIDEO) {
-        av_frame_free(&video_stream->m_frame);
-        video_stream->m_frame = av_frame_clone(frame);
+        av_frame_unref(video_stream->m_frame);
+
+        if (av_frame_ref(video_stream->m_frame, frame) < 0) {
+            captainslog_error("Failed to reference video frame");
+            return;
+        }
+
         video_stream->m_gotFrame = true;
     }
 #ifdef BUILD_WITH_OPENAL
@@ -94,6 +101,25 @@ void FFmpegVideoStream::On_Frame(AVFrame *frame, int stream_idx, int stream_type
 #endif
 }
 
+/**
+ * Decode packets until the next video frame arrives or the file runs out.
+ */
+void FFmpegVideoStream::Decode_Next_Frame()
+{
+    int64_t start = av_gettime_relative();
+
+    while (m_good && m_gotFrame == false)
+        m_good = m_ffmpegFile->Decode_Packet();
+
+    int64_t elapsed = av_gettime_relative() - start;
+    m_stats.decode_time += elapsed;
+    m_stats.max_decode_time = std::max(m_stats.max_decode_time, elapsed);
+
+    if (m_gotFrame) {
+        ++m_stats.frames_decoded;
+    }
+}
+
 /**
  * Update the stream state.
  */
@@ -136,7 +162,7 @@ void FFmpegVideoStream::Render_Frame(VideoBuffer *buffer)
         return;
     }
 
-    if (m_frame->data == nullptr) {
+    if (m_frame->data[0] == nullptr) {
         return;
     }
 
@@ -159,6 +185,12 @@ void FFmpegVideoStream::Render_Frame(VideoBuffer *buffer)
             return;
     }
 
+    // When the buffer matches the video size only the colourspace needs converting, otherwise a cheap filter is
+    // plenty for movies that are only ever scaled up to the screen.
+    bool same_size = buffer->Get_Width() == static_cast<unsigned>(Width())
+        && buffer->Get_Height() == static_cast<unsigned>(Height());
+    int flags = same_size ? SWS_POINT : SWS_FAST_BILINEAR;
+
     m_swsContext = sws_getCachedContext(m_swsContext,
         Width(),
         Height(),
@@ -166,11 +198,12 @@ void FFmpegVideoStream::Render_Frame(VideoBuffer *buffer)
         buffer->Get_Width(),
         buffer->Get_Height(),
         dst_pix_fmt,
-        SWS_BICUBIC,
+        flags,
         NULL,
         NULL,
         NULL);
 
+    int64_t start = av_gettime_relative();
     uint8_t *buffer_data = static_cast<uint8_t *>(buffer->Lock());
     if (buffer_data == nullptr) {
         captainslog_error("Failed to lock videobuffer");
@@ -184,6 +217,14 @@ void FFmpegVideoStream::Render_Frame(VideoBuffer *buffer)
         captainslog_error("Failed to write into videobuffer");
     }
     buffer->Unlock();
+
+    int64_t elapsed = av_gettime_relative() - start;
+    m_stats.convert_time += elapsed;
+    m_stats.max_convert_time = std::max(m_stats.max_convert_time, elapsed);
+
+    if (result >= 0) {
+        ++m_stats.frames_rendered;
+    }
 }
 
 /**
@@ -192,9 +233,7 @@ void FFmpegVideoStream::Render_Frame(VideoBuffer *buffer)
 void FFmpegVideoStream::Next_Frame()
 {
     m_gotFrame = false;
-    // Decode until we have our next video frame
-    while (m_good && m_gotFrame == false)
-        m_good = m_ffmpegFile->Decode_Packet();
+    Decode_Next_Frame();
 }
 
 /*
@@ -23,6 +23,18 @@ struct SwsContext;
 namespace Thyme
 {
 class FFmpegFile;
+
+// Frame counts and the time in microseconds spent decoding packets and converting frames into video buffers.
+struct FFmpegVideoStats
+{
+    unsigned frames_decoded = 0;
+    unsigned frames_rendered = 0;
+    int64_t decode_time = 0;
+    int64_t convert_time = 0;
+    int64_t max_decode_time = 0;
+    int64_t max_convert_time = 0;
+};
+
 class FFmpegVideoStream final : public VideoStream
 {
     friend class FFmpegVideoPlayer;
@@ -43,8 +55,12 @@ public:
     virtual int Height() override;
     virtual int Width() override;
 
+    const FFmpegVideoStats &Get_Stats() const { return m_stats; }
+    void Reset_Stats() { m_stats = FFmpegVideoStats(); }
+
 private:
     static void On_Frame(AVFrame *frame, int stream_idx, int stream_type, void *user_data);
+    void Decode_Next_Frame();
     AVFrame *m_frame = nullptr;
     SwsContext *m_swsContext = nullptr;
     FFmpegFile *m_ffmpegFile = nullptr;
@@ -52,6 +68,7 @@ private:
     bool m_gotFrame = false;
     unsigned int m_startTime = 0;
     uint8_t *m_audio_buffer = nullptr;
+    FFmpegVideoStats m_stats;
 #ifdef BUILD_WITH_OPENAL
     ALAudioStream *m_audioStream = nullptr;
 #endif
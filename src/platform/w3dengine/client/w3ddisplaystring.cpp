@@ -28,6 +28,8 @@ W3DDisplayString::W3DDisplayString() :
     m_y(0),
     m_textColor(0),
     m_borderColor(0),
+    m_borderXOffset(1),
+    m_borderYOffset(1),
     m_xExtent(0),
     m_yExtent(0),
     m_frame(0)
@@ -116,6 +118,27 @@ void W3DDisplayString::Draw(int x, int y, int color, int border_color, int borde
                 m_frame = g_theGameClient->Get_Frame();
             }
 
+            return;
+        } else if (color == m_textColor && border_color == m_borderColor && border_x_offset == m_borderXOffset
+            && border_y_offset == m_borderYOffset && !m_sentence.Is_Clipping_Enabled()
+            && !m_hotKeySentence.Is_Clipping_Enabled()) {
+            // Only the position changed, shift the quads already built rather than laying them out again.
+            Vector2 dif(x - m_x, y - m_y);
+            m_x = x;
+            m_y = y;
+            m_sentence.Move_Location(dif);
+
+            if (m_hotKeyState) {
+                m_hotKeySentence.Move_Location(dif);
+                m_hotKeySentence.Render();
+            }
+
+            m_sentence.Render();
+
+            if (g_theGameClient != nullptr) {
+                m_frame = g_theGameClient->Get_Frame();
+            }
+
             return;
         }
 
@@ -123,6 +146,8 @@ void W3DDisplayString::Draw(int x, int y, int color, int border_color, int borde
         m_y = y;
         m_textColor = color;
         m_borderColor = border_color;
+        m_borderXOffset = border_x_offset;
+        m_borderYOffset = border_y_offset;
         m_sentence.Reset_Polys();
         m_sentence.Set_Location(Vector2(m_x + border_x_offset, m_y + border_y_offset));
         m_sentence.Draw_Sentence(m_borderColor);
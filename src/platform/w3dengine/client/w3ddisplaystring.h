@@ -54,6 +54,8 @@ private:
     int m_y;
     int m_textColor;
     int m_borderColor;
+    int m_borderXOffset;
+    int m_borderYOffset;
     int m_xExtent;
     int m_yExtent;
     IRegion2D m_clipRegion;
@@ -240,6 +240,23 @@ bool RTS3DScene::Cast_Ray(RayCollisionTestClass &ray_test, bool test_all, int co
     return hit;
 }
 
+// Same result as CameraClass::Cull_Sphere, but inlined against a frustum fetched once per visibility pass. The side
+// planes are tested first as they reject almost everything that is off screen for a top down camera.
+static inline bool Cull_Sphere_On_Planes(const PlaneClass *planes, const SphereClass &sphere)
+{
+    static const int s_planeOrder[6] = { 1, 2, 3, 4, 0, 5 };
+
+    for (int i = 0; i < 6; i++) {
+        const PlaneClass &plane = planes[s_planeOrder[i]];
+
+        if (Vector3::Dot_Product(sphere.Center, plane.N) - plane.D > sphere.Radius) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void RTS3DScene::Visibility_Check(CameraClass *camera)
 {
     Drawable::Friend_Lock_Dirty_Stuff_For_Iteration();
@@ -260,6 +277,10 @@ void RTS3DScene::Visibility_Check(CameraClass *camera)
         frame = g_theWriteableGlobalData->m_defaultOcclusionDelay + 1;
     }
 
+    const PlaneClass *planes = camera->Get_Frustum().m_planes;
+    bool occlusion = g_theWriteableGlobalData->m_useBehindBuildingMarker && g_theGameLogic != nullptr
+        && g_theGameLogic->Get_Occlusion_Enabled();
+
     if (!ShaderClass::Is_Backface_Culling_Inverted()) {
         for (iter.First(); !iter.Is_Done(); iter.Next()) {
             RenderObjClass *robj = iter.Peek_Obj();
@@ -274,7 +295,7 @@ void RTS3DScene::Visibility_Check(CameraClass *camera)
                 continue;
             }
 
-            bool cull = camera->Cull_Sphere(robj->Get_Bounding_Sphere());
+            bool cull = Cull_Sphere_On_Planes(planes, robj->Get_Bounding_Sphere());
             bool visible = !cull;
 
             if (cull) {
@@ -310,31 +331,29 @@ void RTS3DScene::Visibility_Check(CameraClass *camera)
                     m_translucentObjectsBuffer[m_translucentObjectsCount++] = robj;
                 }
 
-                if (g_theWriteableGlobalData->m_useBehindBuildingMarker) {
-                    if (g_theGameLogic->Get_Occlusion_Enabled()) {
-                        if (drawable->Is_KindOf(KINDOF_STRUCTURE)
-                            && m_occludedBuildingsCount < g_theWriteableGlobalData->m_maxOccludedBuildings) {
-
-                            if (info->flags != 8) {
-                                m_occludedBuildingsBuffer[m_occludedBuildingsCount++] = robj;
-                            }
-
-                            info->flags |= 2;
-                        } else if (drawable->Get_Object()
-                            && (drawable->Is_KindOf(KINDOF_SCORE) || drawable->Is_KindOf(KINDOF_SCORE_CREATE)
-                                || drawable->Is_KindOf(KINDOF_SCORE_DESTROY)
-                                || drawable->Is_KindOf(KINDOF_MP_COUNT_FOR_VICTORY))
-                            && drawable->Get_Object()->Get_Occlusion_Delay_Frame() <= frame
-                            && m_occludedObjectsCount < g_theWriteableGlobalData->m_maxOccludedObjects) {
-                            m_occludedObjectsBuffer[m_occludedObjectsCount++] = robj;
-                            info->flags |= 4;
-                        } else if (!info->flags && m_occludedOthersCount < g_theWriteableGlobalData->m_maxOccludedOthers) {
-                            if (info->flags != 8) {
-                                m_occludedOthersBuffer[m_occludedOthersCount++] = robj;
-                            }
-
-                            info->flags |= 16;
+                if (occlusion) {
+                    if (drawable->Is_KindOf(KINDOF_STRUCTURE)
+                        && m_occludedBuildingsCount < g_theWriteableGlobalData->m_maxOccludedBuildings) {
+
+                        if (info->flags != 8) {
+                            m_occludedBuildingsBuffer[m_occludedBuildingsCount++] = robj;
                         }
+
+                        info->flags |= 2;
+                    } else if (drawable->Get_Object()
+                        && (drawable->Is_KindOf(KINDOF_SCORE) || drawable->Is_KindOf(KINDOF_SCORE_CREATE)
+                            || drawable->Is_KindOf(KINDOF_SCORE_DESTROY)
+                            || drawable->Is_KindOf(KINDOF_MP_COUNT_FOR_VICTORY))
+                        && drawable->Get_Object()->Get_Occlusion_Delay_Frame() <= frame
+                        && m_occludedObjectsCount < g_theWriteableGlobalData->m_maxOccludedObjects) {
+                        m_occludedObjectsBuffer[m_occludedObjectsCount++] = robj;
+                        info->flags |= 4;
+                    } else if (!info->flags && m_occludedOthersCount < g_theWriteableGlobalData->m_maxOccludedOthers) {
+                        if (info->flags != 8) {
+                            m_occludedOthersBuffer[m_occludedOthersCount++] = robj;
+                        }
+
+                        info->flags |= 16;
                     }
                 }
 
@@ -358,7 +377,7 @@ void RTS3DScene::Visibility_Check(CameraClass *camera)
                     int visible = 0;
 
                     if (drawable->Get_Draws_In_Mirror()) {
-                        if (!camera->Cull_Sphere(robj->Get_Bounding_Sphere())) {
+                        if (!Cull_Sphere_On_Planes(planes, robj->Get_Bounding_Sphere())) {
                             visible = 1;
                         }
                     }
@@ -368,7 +387,7 @@ void RTS3DScene::Visibility_Check(CameraClass *camera)
             } else if (robj->Is_Force_Visible()) {
                 robj->Set_Visible(true);
             } else {
-                robj->Set_Visible(!camera->Cull_Sphere(robj->Get_Bounding_Sphere()));
+                robj->Set_Visible(!Cull_Sphere_On_Planes(planes, robj->Get_Bounding_Sphere()));
             }
         }
     }
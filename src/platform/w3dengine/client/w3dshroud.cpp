@@ -51,6 +51,9 @@ W3DShroud::W3DShroud() :
     m_srcFogArray(nullptr),
     m_destFogArray(nullptr)
 {
+#ifndef GAME_DLL
+    Clear_Dirty();
+#endif
 }
 
 W3DShroud ::~W3DShroud()
@@ -125,6 +128,9 @@ void W3DShroud::Init(WorldHeightMap *map, float world_cell_size_x, float world_c
     m_srcTextureData = static_cast<unsigned char *>(r.pBits);
     m_srcTexturePitch = r.Pitch;
     memset(m_srcTextureData, 0, y * m_srcTexturePitch);
+#ifndef GAME_DLL
+    Mark_All_Dirty();
+#endif
 
 #ifdef GAME_DEBUG_STRUCTS
     if (g_theWriteableGlobalData && g_theWriteableGlobalData->m_fogOfWarOn) {
@@ -243,10 +249,11 @@ void W3DShroud::Set_Shroud_Level(int x, int y, unsigned char level, bool unk)
                 level = g_theWriteableGlobalData->m_shroudAlpha;
             }
 
+            unsigned short data;
+
 #ifdef GAME_DEBUG_STRUCTS
             if (g_theWriteableGlobalData && g_theWriteableGlobalData->m_fogOfWarOn) {
-                *reinterpret_cast<unsigned short *>(&m_srcTextureData[2 * x + m_srcTexturePitch * y]) =
-                    ((((0xFF - level) >> 4) & 0xF) << 12)
+                data = ((((0xFF - level) >> 4) & 0xF) << 12)
                     | ((((int)g_theWriteableGlobalData->m_shroudColor.red >> 4) & 0xF) << 8)
                     | (16 * (((int)g_theWriteableGlobalData->m_shroudColor.green >> 4) & 0xF))
                     | ((int)g_theWriteableGlobalData->m_shroudColor.blue >> 4) & 0xF;
@@ -263,8 +270,7 @@ void W3DShroud::Set_Shroud_Level(int x, int y, unsigned char level, bool unk)
                     r = 0xFF;
                 }
 
-                *reinterpret_cast<unsigned short *>(&m_srcTextureData[2 * x + m_srcTexturePitch * y]) =
-                    ((b & 0xF8) << 8) | (8 * (g & 0xFC)) | ((unsigned char)(r & 0xF8) >> 3);
+                data = ((b & 0xF8) << 8) | (8 * (g & 0xFC)) | ((unsigned char)(r & 0xF8) >> 3);
             }
 #else
             float c = (float)level;
@@ -278,8 +284,18 @@ void W3DShroud::Set_Shroud_Level(int x, int y, unsigned char level, bool unk)
                 r = 0xFF;
             }
 
-            *reinterpret_cast<unsigned short *>(&m_srcTextureData[2 * x + m_srcTexturePitch * y]) =
-                ((b & 0xF8) << 8) | (8 * (g & 0xFC)) | ((unsigned char)(r & 0xF8) >> 3);
+            data = ((b & 0xF8) << 8) | (8 * (g & 0xFC)) | ((unsigned char)(r & 0xF8) >> 3);
+#endif
+            unsigned short *texel = reinterpret_cast<unsigned short *>(&m_srcTextureData[2 * x + m_srcTexturePitch * y]);
+
+#ifdef GAME_DLL
+            *texel = data;
+#else
+            // Only texels that actually change grow the region uploaded on the next render.
+            if (*texel != data) {
+                *texel = data;
+                Mark_Dirty(x, y);
+            }
 #endif
         }
     }
@@ -327,6 +343,7 @@ void W3DShroud::Fill_Shroud_Data(unsigned char level)
     data = ((b & 0xF8) << 8) | (8 * (g & 0xFC)) | ((unsigned char)(r & 0xF8) >> 3);
 #endif
 
+#ifdef GAME_DLL
     unsigned char *src = m_srcTextureData;
     int pitch = m_srcTexturePitch >> 1;
 
@@ -337,7 +354,29 @@ void W3DShroud::Fill_Shroud_Data(unsigned char level)
 
         src += 2 * pitch;
     }
+#else
+    Fill_Shroud_Rows(data, m_numCellsY);
+    Mark_All_Dirty();
+#endif
+}
+
+#ifndef GAME_DLL
+void W3DShroud::Fill_Shroud_Rows(unsigned short data, int rows)
+{
+    if (rows <= 0 || m_numCellsX <= 0) {
+        return;
+    }
+
+    // Fill the first row with a pattern fill the compiler can vectorise, then replicate it as whole rows.
+    unsigned short *first_row = reinterpret_cast<unsigned short *>(m_srcTextureData);
+    std::fill_n(first_row, m_numCellsX, data);
+    size_t row_bytes = m_numCellsX * sizeof(unsigned short);
+
+    for (int i = 1; i < rows; i++) {
+        memcpy(&m_srcTextureData[m_srcTexturePitch * i], first_row, row_bytes);
+    }
 }
+#endif
 
 void W3DShroud::Fill_Border_Shroud_Data(unsigned char level, SurfaceClass *surface)
 {
@@ -383,9 +422,13 @@ void W3DShroud::Fill_Border_Shroud_Data(unsigned char level, SurfaceClass *surfa
 #endif
     unsigned char *src = &m_srcTextureData[2 * (m_srcTexturePitch >> 1) * m_numCellsY];
 
+#ifdef GAME_DLL
     for (int i = 0; i < m_numCellsX; i++) {
         *reinterpret_cast<unsigned short *>(&src[2 * i]) = data;
     }
+#else
+    std::fill_n(reinterpret_cast<unsigned short *>(src), m_numCellsX, data);
+#endif
 
     RECT src_rect;
     src_rect.left = 0;
@@ -474,9 +517,29 @@ void W3DShroud::Render(CameraClass *cam)
             if (m_fillBorderShroudData) {
                 m_fillBorderShroudData = false;
                 Fill_Border_Shroud_Data(m_shroudAlpha, surface);
+#ifndef GAME_DLL
+                // The border fill overwrites the whole destination so everything needs copying again.
+                Mark_All_Dirty();
+#endif
             }
 
+#ifdef GAME_DLL
             DX8Wrapper::Copy_DX8_Rects(m_pSrcTexture, &src_rect, 1, surface->Peek_D3D_Surface(), &point);
+#else
+            // Only copy the region that has changed since the last frame.
+            src_rect.left = std::max(visible_start_x, m_dirtyMinX);
+            src_rect.top = std::max(visible_start_y, m_dirtyMinY);
+            src_rect.right = std::min(visible_end_x, m_dirtyMaxX);
+            src_rect.bottom = std::min(visible_end_y, m_dirtyMaxY);
+
+            if (src_rect.left < src_rect.right && src_rect.top < src_rect.bottom) {
+                point.x += src_rect.left - visible_start_x;
+                point.y += src_rect.top - visible_start_y;
+                DX8Wrapper::Copy_DX8_Rects(m_pSrcTexture, &src_rect, 1, surface->Peek_D3D_Surface(), &point);
+            }
+
+            Clear_Dirty();
+#endif
             Ref_Ptr_Release(surface);
         }
     }
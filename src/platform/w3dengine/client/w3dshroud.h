@@ -17,6 +17,7 @@
 #include "matpass.h"
 #include "texture.h"
 #include "w3dtypes.h"
+#include <algorithm>
 
 class CameraClass;
 class WorldHeightMap;
@@ -53,6 +54,32 @@ public:
 #endif
 
 private:
+#ifndef GAME_DLL
+    void Fill_Shroud_Rows(unsigned short data, int rows);
+    void Mark_Dirty(int x, int y)
+    {
+        m_dirtyMinX = std::min(m_dirtyMinX, x);
+        m_dirtyMinY = std::min(m_dirtyMinY, y);
+        m_dirtyMaxX = std::max(m_dirtyMaxX, x + 1);
+        m_dirtyMaxY = std::max(m_dirtyMaxY, y + 1);
+    }
+    void Mark_All_Dirty()
+    {
+        m_dirtyMinX = 0;
+        m_dirtyMinY = 0;
+        m_dirtyMaxX = m_numCellsX;
+        m_dirtyMaxY = m_numCellsY;
+    }
+    void Clear_Dirty()
+    {
+        m_dirtyMinX = m_numCellsX;
+        m_dirtyMinY = m_numCellsY;
+        m_dirtyMaxX = 0;
+        m_dirtyMaxY = 0;
+    }
+    bool Is_Dirty() const { return m_dirtyMinX < m_dirtyMaxX && m_dirtyMinY < m_dirtyMaxY; }
+#endif
+
     int m_numCellsX;
     int m_numCellsY;
     int m_numMaxVisibleCellsX;
@@ -74,6 +101,13 @@ private:
     unsigned char m_shroudAlpha;
     unsigned char *m_srcFogArray;
     unsigned char *m_destFogArray;
+#ifndef GAME_DLL
+    // Cell region changed since the last upload to the destination texture, max values are exclusive.
+    int m_dirtyMinX;
+    int m_dirtyMinY;
+    int m_dirtyMaxX;
+    int m_dirtyMaxY;
+#endif
 };
 
 class W3DShroudMaterialPassClass : public MaterialPassClass
@@ -138,6 +138,13 @@ void W3DTreeBuffer::Xfer_Snapshot(Xfer *xfer)
 
     if (xfer->Get_Mode() == XFER_LOAD) {
         m_numTrees = 0;
+#ifndef GAME_DLL
+        m_animatingTrees.clear();
+
+        for (int i = 0; i < MAX_TREES; i++) {
+            m_treeAnimating[i] = false;
+        }
+#endif
 
         for (int i = 0; i < MAX_PARTITON_INDICES; i++) {
             m_partitionIndices[i] = -1;
@@ -204,6 +211,11 @@ void W3DTreeBuffer::Xfer_Snapshot(Xfer *xfer)
                 tree2->options = tree.options;
                 tree2->topple_transform = tree.topple_transform;
                 tree2->topple_sink_countdown = tree.topple_sink_countdown;
+#ifndef GAME_DLL
+                if (tree2->topple_state != TTree::TOPPLE_UPRIGHT) {
+                    Mark_Tree_Animating(m_numTrees - 1);
+                }
+#endif
             }
         }
     }
@@ -271,6 +283,10 @@ void W3DTreeBuffer::Add_Tree(
         m_trees[m_numTrees].push_aside_location.y = 1.0f;
         m_trees[m_numTrees].push_aside_location.x = 1.0f;
         m_trees[m_numTrees].topple_state = TTree::TOPPLE_UPRIGHT;
+#ifndef GAME_DLL
+        m_treeAnimating[m_numTrees] = false;
+        m_cullBucketsDirty = true;
+#endif
         m_numTrees++;
     }
 }
@@ -411,6 +427,14 @@ void W3DTreeBuffer::Clear_All_Trees()
     }
 
     m_numTreeTypes = 0;
+#ifndef GAME_DLL
+    m_cullBucketsDirty = true;
+    m_animatingTrees.clear();
+
+    for (int i = 0; i < MAX_TREES; i++) {
+        m_treeAnimating[i] = false;
+    }
+#endif
 }
 
 void W3DTreeBuffer::Free_Tree_Buffers()
@@ -511,6 +535,9 @@ bool W3DTreeBuffer::Update_Tree_Position(DrawableID drawable, Coord3D pos, float
             m_trees[i].bounds.Radius *= m_trees[i].scale;
             m_trees[i].bounds.Center += m_trees[i].location;
             m_anythingChanged = true;
+#ifndef GAME_DLL
+            m_cullBucketsDirty = true;
+#endif
             return true;
         }
     }
@@ -844,6 +871,7 @@ void W3DTreeBuffer::Cull(const CameraClass *camera)
     float z = -1.0f * tm[2][2];
     m_cameraLookAtVector.Set(x, y, z);
 
+#ifdef GAME_DLL
     for (int i = 0; i < m_numTrees; i++) {
         bool sort = false;
         bool visible = !camera->Cull_Sphere(m_trees[i].bounds);
@@ -861,10 +889,96 @@ void W3DTreeBuffer::Cull(const CameraClass *camera)
             m_trees[i].sort_key = m_trees[i].location * m_cameraLookAtVector;
         }
     }
+#else
+    if (m_cullBucketsDirty) {
+        Build_Cull_Buckets();
+    }
+
+    for (int b = 0; b < MAX_CULL_BUCKETS; b++) {
+        const TreeCullBucket &bucket = m_cullBuckets[b];
+
+        if (bucket.trees.empty()) {
+            continue;
+        }
+
+        // Trees in a block that is outside the frustum are all hidden without testing them individually.
+        bool bucket_visible = !camera->Cull_Sphere(bucket.bounds);
+
+        for (int i : bucket.trees) {
+            bool sort = false;
+            bool visible = bucket_visible && !camera->Cull_Sphere(m_trees[i].bounds);
+
+            if (visible != m_trees[i].visible) {
+                m_trees[i].visible = visible;
+                m_anythingChanged = true;
+
+                if (visible) {
+                    sort = true;
+                }
+            }
+
+            if (sort || (visible && m_updateAllKeys)) {
+                m_trees[i].sort_key = m_trees[i].location * m_cameraLookAtVector;
+            }
+        }
+    }
+#endif
 
     m_updateAllKeys = false;
 }
 
+#ifndef GAME_DLL
+void W3DTreeBuffer::Build_Cull_Buckets()
+{
+    for (int b = 0; b < MAX_CULL_BUCKETS; b++) {
+        m_cullBuckets[b].trees.clear();
+    }
+
+    for (int i = 0; i < m_numTrees; i++) {
+        Coord3D loc;
+        loc.Set(m_trees[i].location.X, m_trees[i].location.Y, m_trees[i].location.Z);
+        int partition_bucket = Get_Partition_Bucket(&loc);
+        int x_index = (partition_bucket % PARTITION_WIDTH_HEIGHT) / CULL_BUCKET_SIZE;
+        int y_index = (partition_bucket / PARTITION_WIDTH_HEIGHT) / CULL_BUCKET_SIZE;
+        TreeCullBucket &bucket = m_cullBuckets[x_index + CULL_BUCKET_WIDTH_HEIGHT * y_index];
+
+        if (bucket.trees.empty()) {
+            bucket.bounds = m_trees[i].bounds;
+        } else {
+            bucket.bounds.Add_Sphere(m_trees[i].bounds);
+        }
+
+        bucket.trees.push_back(i);
+    }
+
+    m_cullBucketsDirty = false;
+}
+
+void W3DTreeBuffer::Mark_Tree_Animating(int tree)
+{
+    if (!m_treeAnimating[tree]) {
+        m_treeAnimating[tree] = true;
+        m_animatingTrees.push_back(tree);
+    }
+}
+
+void W3DTreeBuffer::Prune_Animating_Trees()
+{
+    for (size_t n = 0; n < m_animatingTrees.size();) {
+        int tree = m_animatingTrees[n];
+
+        if (m_trees[tree].tree_type >= 0
+            && (m_trees[tree].push_aside_move_time != 0.0f || m_trees[tree].topple_state != TTree::TOPPLE_UPRIGHT)) {
+            n++;
+        } else {
+            m_treeAnimating[tree] = false;
+            m_animatingTrees[n] = m_animatingTrees.back();
+            m_animatingTrees.pop_back();
+        }
+    }
+}
+#endif
+
 void W3DTreeBuffer::Apply_Toppling_Force(TTree *tree, const Coord3D *pos, float speed, int options)
 {
     if (tree->topple_state == TTree::TOPPLE_UPRIGHT) {
@@ -887,6 +1001,9 @@ void W3DTreeBuffer::Apply_Toppling_Force(TTree *tree, const Coord3D *pos, float
         m_vertexesDirty = true;
         tree->topple_transform.Make_Identity();
         tree->topple_transform.Set_Translation(tree->location);
+#ifndef GAME_DLL
+        Mark_Tree_Animating(tree - m_trees);
+#endif
     }
 }
 
@@ -984,6 +1101,9 @@ void W3DTreeBuffer::Push_Aside_Tree(DrawableID drawable, const Coord3D *pos, con
 
             m_vertexesDirty = true;
             m_trees[i].push_aside_move_time = 1.0f / m_treeTypes[m_trees[i].tree_type].module->m_moveOutwardTime;
+#ifndef GAME_DLL
+            Mark_Tree_Animating(i);
+#endif
         }
     }
 }
@@ -1185,7 +1305,14 @@ void W3DTreeBuffer::Update_Vertex_Buffer()
             VertexBufferClass::WriteLockClass lock(m_vertexTree[i], 0);
             VertexFormatXYZNDUV1 *vertexes = static_cast<VertexFormatXYZNDUV1 *>(lock.Get_Vertex_Array());
 
+#ifdef GAME_DLL
             for (int tree = 0; tree < m_numTrees; tree++) {
+#else
+            Prune_Animating_Trees();
+
+            for (size_t n = 0; n < m_animatingTrees.size(); n++) {
+                int tree = m_animatingTrees[n];
+#endif
                 if (m_trees[tree].vb_index == i) {
                     int tree_type = m_trees[tree].tree_type;
 
@@ -1426,7 +1553,13 @@ void W3DTreeBuffer::Draw_Trees(CameraClass *camera, RefMultiListIterator<class R
                 g_theW3DProjectedShadowManager->Flush_Decals(m_decalShadow->Get_Texture(0), SHADOW_DECAL);
             }
 
+#ifdef GAME_DLL
             for (int j = 0; j < m_numTrees && !frozen; j++) {
+#else
+            // Trees that are upright and not pushed aside have nothing to advance.
+            for (size_t n = 0; n < m_animatingTrees.size() && !frozen; n++) {
+                int j = m_animatingTrees[n];
+#endif
                 int tree_type = m_trees[j].tree_type;
 
                 if (tree_type >= 0) {
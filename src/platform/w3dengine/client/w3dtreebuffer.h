@@ -23,6 +23,7 @@
 #include "sphere.h"
 #include "texture.h"
 #include "vector3.h"
+#include <vector>
 
 class MeshClass;
 class W3DTreeDrawModuleData;
@@ -165,7 +166,13 @@ public:
     void Apply_Toppling_Force(TTree *tree, const Coord3D *pos, float speed, int options); // WB 0x00654094
     void Update_Toppling_Tree(TTree *tree); // WB 0x006541A0
 
-    void Set_Partition_Region(Region2D *region) { m_partitionRegion = *region; } // WB 0x00604BD0
+    void Set_Partition_Region(Region2D *region) // WB 0x00604BD0
+    {
+        m_partitionRegion = *region;
+#ifndef GAME_DLL
+        m_cullBucketsDirty = true;
+#endif
+    }
     void Do_Full_Update() { m_updateAllKeys = true; } // WB 0x00604C00
     void Set_Is_Terrain() { m_isTerrainPass = true; } // WB 0x0060D390
     int Get_Num_Tiles() { return m_numTiles; } // WB 0x00654AD0
@@ -181,8 +188,23 @@ private:
         MAX_TILE_SIZE = 512,
         PARTITION_WIDTH_HEIGHT = 100,
         MAX_PARTITON_INDICES = PARTITION_WIDTH_HEIGHT * PARTITION_WIDTH_HEIGHT,
+        CULL_BUCKET_SIZE = 10,
+        CULL_BUCKET_WIDTH_HEIGHT = PARTITION_WIDTH_HEIGHT / CULL_BUCKET_SIZE,
+        MAX_CULL_BUCKETS = CULL_BUCKET_WIDTH_HEIGHT * CULL_BUCKET_WIDTH_HEIGHT,
+    };
+
+#ifndef GAME_DLL
+    struct TreeCullBucket
+    {
+        SphereClass bounds;
+        std::vector<int> trees;
     };
 
+    void Build_Cull_Buckets();
+    void Mark_Tree_Animating(int tree);
+    void Prune_Animating_Trees();
+#endif
+
     DX8VertexBufferClass *m_vertexTree[1]; // confirmed
     DX8IndexBufferClass *m_indexTree[1]; // confirmed
     unsigned long m_dwTreePixelShader; // confirmed
@@ -213,4 +235,12 @@ private:
     float m_swayPeriods[10];
     float m_swayLeanAngles[10];
     W3DProjectedShadow *m_decalShadow;
+#ifndef GAME_DLL
+    // Square blocks of partition buckets with merged bounds so a whole block of trees can be culled with one test.
+    TreeCullBucket m_cullBuckets[MAX_CULL_BUCKETS];
+    bool m_cullBucketsDirty;
+    // Trees being pushed aside or toppled, which are the only ones Update_Vertex_Buffer needs to rewrite.
+    std::vector<int> m_animatingTrees;
+    bool m_treeAnimating[MAX_TREES];
+#endif
 };
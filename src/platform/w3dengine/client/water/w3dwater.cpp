@@ -36,6 +36,8 @@
 #include "w3dwatertracks.h"
 #include "water.h"
 #include "xfer.h"
+#include <algorithm>
+#include <climits>
 
 #ifdef BUILD_WITH_D3D8
 #include <d3dx8.h>
@@ -99,6 +101,9 @@ WaterRenderObjClass::WaterRenderObjClass() :
 {
     m_gridWidth = m_gridCellsX * m_gridCellSize;
     m_gridHeight = m_gridCellsY * m_gridCellSize;
+#ifndef GAME_DLL
+    Reset_Motion_Bounds();
+#endif
 }
 
 WaterRenderObjClass::~WaterRenderObjClass()
@@ -704,6 +709,9 @@ void WaterRenderObjClass::Reset()
         }
 
         m_meshInMotion = false;
+#ifndef GAME_DLL
+        Reset_Motion_Bounds();
+#endif
     }
 
     if (m_waterTrackSystem) {
@@ -781,6 +789,7 @@ void WaterRenderObjClass::Update()
     if (lastLogicFrame != frame) {
         if (m_doWaterGrid) {
             if (m_meshInMotion) {
+#ifdef GAME_DLL
                 int x = m_gridCellsX + 1;
                 int y = m_gridCellsY + 1;
                 m_meshInMotion = false;
@@ -812,6 +821,44 @@ void WaterRenderObjClass::Update()
                         m++;
                     }
                 }
+#else
+                int stride = m_gridCellsX + 3;
+                int min_x = m_motionMinX;
+                int min_y = m_motionMinY;
+                int max_x = m_motionMaxX;
+                int max_y = m_motionMaxY;
+                float gravity = g_theWriteableGlobalData->m_gravity * 3.0f;
+                m_meshInMotion = false;
+                Reset_Motion_Bounds();
+
+                for (int i = min_y; i < max_y; i++) {
+                    WaterMeshData *m = &m_meshData[stride * i + min_x];
+
+                    for (int j = min_x; j < max_x; j++, m++) {
+                        if ((m->status & 1) != 0) {
+                            m->velocity = 0.93f * m->velocity;
+
+                            if (m->preferred_height > m->height) {
+                                m->velocity = m->velocity - gravity;
+                            } else {
+                                m->velocity = gravity + m->velocity;
+                            }
+
+                            m->height = m->height + m->velocity;
+
+                            if (GameMath::Fabs(m->height - m->preferred_height) < 1.0f
+                                && GameMath::Fabs(m->velocity) < 1.0f) {
+                                m->status &= ~1;
+                                m->height = m->preferred_height;
+                                m->velocity = 0.0f;
+                            } else {
+                                m_meshInMotion = true;
+                                Expand_Motion_Bounds(j, i, j + 1, i + 1);
+                            }
+                        }
+                    }
+                }
+#endif
             }
         }
         lastLogicFrame = frame;
@@ -1578,6 +1625,12 @@ void WaterRenderObjClass::Add_Velocity(float world_x, float world_y, float z_vel
             }
 
             m_meshInMotion = true;
+#ifndef GAME_DLL
+            Expand_Motion_Bounds(static_cast<int>(minx) + 1,
+                static_cast<int>(miny) + 1,
+                static_cast<int>(maxx) + 1,
+                static_cast<int>(maxy) + 1);
+#endif
         }
     }
 }
@@ -1633,6 +1686,24 @@ void WaterRenderObjClass::Change_Grid_Height(float wx, float wy, float delta)
     }
 }
 
+#ifndef GAME_DLL
+void WaterRenderObjClass::Reset_Motion_Bounds()
+{
+    m_motionMinX = INT_MAX;
+    m_motionMinY = INT_MAX;
+    m_motionMaxX = 0;
+    m_motionMaxY = 0;
+}
+
+void WaterRenderObjClass::Expand_Motion_Bounds(int min_x, int min_y, int max_x, int max_y)
+{
+    m_motionMinX = std::min(m_motionMinX, min_x);
+    m_motionMinY = std::min(m_motionMinY, min_y);
+    m_motionMaxX = std::max(m_motionMaxX, max_x);
+    m_motionMaxY = std::max(m_motionMaxY, max_y);
+}
+#endif
+
 void WaterRenderObjClass::Set_Grid_Change_Attenuation_Factors(float att_0, float att_1, float att_2, float range)
 {
     m_gridChangeAtt0 = att_0;
@@ -2339,6 +2410,14 @@ void WaterRenderObjClass::Xfer_Snapshot(Xfer *xfer)
         xfer->xferUnsignedByte(&m_meshData[i].status);
         xfer->xferUnsignedByte(&m_meshData[i].preferred_height);
     }
+
+#ifndef GAME_DLL
+    if (xfer->Get_Mode() == XFER_LOAD && m_meshData != nullptr) {
+        // Which cells were moving isn't saved, let the next update find them.
+        m_meshInMotion = true;
+        Expand_Motion_Bounds(0, 0, m_gridCellsX + 3, m_gridCellsY + 3);
+    }
+#endif
 }
 
 void WaterRenderObjClass::Setup_Jba_Water_Shader()
@@ -144,6 +144,10 @@ protected:
     void Render_Water_Mesh();
     void Setup_Flat_Water_Shader();
     void Setup_Jba_Water_Shader();
+#ifndef GAME_DLL
+    void Reset_Motion_Bounds();
+    void Expand_Motion_Bounds(int min_x, int min_y, int max_x, int max_y);
+#endif
 
     DX8IndexBufferClass *m_indexBuffer;
     SceneClass *m_parentScene;
@@ -213,6 +217,13 @@ protected:
     TextureClass *m_riverAlphaEdge;
     TimeOfDayType m_tod;
     Setting m_settings[TIME_OF_DAY_COUNT];
+#ifndef GAME_DLL
+    // Cells of m_meshData that may still be moving, max exclusive. Update only walks this rectangle.
+    int m_motionMinX;
+    int m_motionMinY;
+    int m_motionMaxX;
+    int m_motionMaxY;
+#endif
 };
 
 #ifdef GAME_DLL
@@ -383,104 +383,56 @@ bool DDSFileClass::Get_4x4_Block(uint8_t *dst_ptr,
     switch (m_format) {
         case WW3D_FORMAT_DXT1: {
             int offset = (src_x / 4) + (src_y / 4) * (Get_Width(level) / 4);
-            unsigned dst_pixel = 0;
             uint8_t *block_mem = &Get_Memory_Pointer(level)[8 * offset];
             uint32_t color_a = Decode_Packed_565(block_mem);
             uint32_t color_b = Decode_Packed_565(block_mem + 2);
-            // uint32_t code = Decode_Line_Code(block_mem + 4);
-
-            if (color_a > color_b) {
-                if (adjust_color) {
-                    Vector4 rgba;
-                    Color_To_RGBA(rgba, color_a);
-                    Adjust_RGBA(rgba, color_shift);
-                    RGBA_To_Color(color_a, rgba);
-                    Color_To_RGBA(rgba, color_b);
-                    Adjust_RGBA(rgba, color_shift);
-                    RGBA_To_Color(color_b, rgba);
-                }
+            bool opaque = color_a > color_b;
+
+            if (adjust_color) {
+                Vector4 rgba;
+                Color_To_RGBA(rgba, color_a);
+                Adjust_RGBA(rgba, color_shift);
+                RGBA_To_Color(color_a, rgba);
+                Color_To_RGBA(rgba, color_b);
+                Adjust_RGBA(rgba, color_shift);
+                RGBA_To_Color(color_b, rgba);
+            }
 
-                for (int j = 0; j < 4; ++j) {
-                    uint8_t *putp = dst_ptr;
-                    dst_ptr += dst_pitch;
-
-                    for (int i = 0; i < 4; ++i) {
-                        uint32_t final_color = 0;
-
-                        switch (block_mem[j + 4] & 3) {
-                            case 0:
-                                final_color = color_a;
-                                break;
-                            case 1:
-                                final_color = color_b;
-                                break;
-                            case 2:
-                                final_color = ((85 * (color_b & 0xFF00) + 170 * (color_a & 0xFF00)) >> 8) & 0xFF00
-                                    | ((85 * (color_b & 0xFF00FF) + 170 * (color_a & 0xFF00FF)) >> 8) & 0xFF00FF;
-                                break;
-                            case 3:
-                                final_color = ((85 * (color_a & 0xFF00) + 170 * (color_b & 0xFF00)) >> 8) & 0xFF00
-                                    | ((85 * (color_a & 0xFF00FF) + 170 * (color_b & 0xFF00FF)) >> 8) & 0xFF00FF;
-                                break;
-                            default:
-                                break;
-                        }
-
-                        final_color |= 0xFF000000;
-                        Color_To_Format(putp, final_color, dst_format);
-                        putp += dst_bpp;
-                    }
-                }
+            // Build the block palette once rather than interpolating for every pixel.
+            uint32_t colors[4];
+            colors[0] = color_a | 0xFF000000;
+            colors[1] = color_b | 0xFF000000;
+
+            if (opaque) {
+                colors[2] = ((85 * (color_b & 0xFF00) + 170 * (color_a & 0xFF00)) >> 8) & 0xFF00
+                    | ((85 * (color_b & 0xFF00FF) + 170 * (color_a & 0xFF00FF)) >> 8) & 0xFF00FF;
+                colors[3] = ((85 * (color_a & 0xFF00) + 170 * (color_b & 0xFF00)) >> 8) & 0xFF00
+                    | ((85 * (color_a & 0xFF00FF) + 170 * (color_b & 0xFF00FF)) >> 8) & 0xFF00FF;
             } else {
-                if (adjust_color) {
-                    Vector4 rgba;
-                    Color_To_RGBA(rgba, color_a);
-                    Adjust_RGBA(rgba, color_shift);
-                    RGBA_To_Color(color_a, rgba);
-                    Color_To_RGBA(rgba, color_b);
-                    Adjust_RGBA(rgba, color_shift);
-                    RGBA_To_Color(color_b, rgba);
-                }
+                colors[2] = ((127 * (color_a & 0xFF00) + ((uint16_t)(color_b & 0xFF00) << 7)) >> 8) & 0xFF00
+                    | ((((color_b & 0xFF00FF) << 7) + 0x7F * (color_a & 0xFF00FF)) >> 8) & 0xFF00FF;
+                colors[3] = 0;
+                has_alpha = true;
+            }
 
-                for (int j = 0; j < 4; ++j) {
-                    uint8_t *putp = dst_ptr;
-                    dst_ptr += dst_pitch;
-
-                    for (int i = 0; i < 4; ++i) {
-                        uint32_t final_color = 0;
-
-                        switch (block_mem[j + 4] & 3) {
-                            case 0:
-                                final_color = color_a;
-                                break;
-                            case 1:
-                                final_color = color_b;
-                                break;
-                            case 2:
-                                final_color =
-                                    ((127 * (color_a & 0xFF00) + ((uint16_t)(color_b & 0xFF00) << 7)) >> 8) & 0xFF00
-                                    | ((((color_b & 0xFF00FF) << 7) + 0x7F * (color_a & 0xFF00FF)) >> 8) & 0xFF00FF;
-                                break;
-                            case 3:
-                                final_color = 0;
-                                break;
-                            default:
-                                break;
-                        }
-
-                        final_color |= 0xFF000000;
-                        Color_To_Format(putp, final_color, dst_format);
-                        putp += dst_bpp;
-                    }
-                }
+            colors[2] |= 0xFF000000;
+            colors[3] |= 0xFF000000;
 
-                has_alpha = true;
+            for (int j = 0; j < 4; ++j) {
+                uint8_t *putp = dst_ptr;
+                dst_ptr += dst_pitch;
+                // Original decoder only reads the low code of each row, all four pixels share it.
+                uint32_t final_color = colors[block_mem[j + 4] & 3];
+
+                for (int i = 0; i < 4; ++i) {
+                    Color_To_Format(putp, final_color, dst_format);
+                    putp += dst_bpp;
+                }
             }
         }
             return has_alpha;
         case WW3D_FORMAT_DXT5: {
             int offset = (src_x / 4) + (src_y / 4) * (Get_Width(level) / 4);
-            unsigned dst_pixel = 0;
             uint8_t *block_mem = &Get_Memory_Pointer(level)[16 * offset];
 
             unsigned alpha0 = *(block_mem);
@@ -508,48 +460,31 @@ bool DDSFileClass::Get_4x4_Block(uint8_t *dst_ptr,
 
             uint32_t color_a = Decode_Packed_565(block_mem + 8);
             uint32_t color_b = Decode_Packed_565(block_mem + 10);
-            unsigned alpha_indices[16];
-
-            for (int i = 0; i < 2; ++i) {
-                // grab 3 bytes
-                int value = 0;
-
-                for (int j = 0; j < 3; ++j) {
-                    int byte = block_mem[2 + j];
-                    value |= (byte << 8 * j);
-                }
-
-                // unpack 8 3-bit values from it
-                for (int j = 0; j < 8; ++j) {
-                    unsigned index = (value >> 3 * j) & 0x7;
-                    alpha_indices[i * 8 + j] = index;
-                }
-            }
+            uint32_t colors[4];
+            colors[0] = color_a;
+            colors[1] = color_b;
+            colors[2] = ((85 * (color_b & 0xFF00) + 170 * (color_a & 0xFF00)) >> 8) & 0xFF00
+                | ((85 * (color_b & 0xFF00FF) + 170 * (color_a & 0xFF00FF)) >> 8) & 0xFF00FF;
+            colors[3] = ((85 * (color_a & 0xFF00) + 170 * (color_b & 0xFF00)) >> 8) & 0xFF00
+                | ((85 * (color_a & 0xFF00FF) + 170 * (color_b & 0xFF00FF)) >> 8) & 0xFF00FF;
+
+            // The original decoder unpacks both halves of the alpha indices from the first three bytes, keep that so
+            // output matches.
+            unsigned alpha_bits = block_mem[2] | (block_mem[3] << 8) | (block_mem[4] << 16);
 
             for (int j = 0; j < 4; j++) {
                 uint8_t *putp = dst_ptr;
                 dst_ptr += dst_pitch;
+                unsigned codes = block_mem[j + 12];
 
                 for (int i = 0; i < 4; i++) {
-                    unsigned alpha = alphas[alpha_indices[j * 4 + i]];
+                    unsigned alpha = alphas[(alpha_bits >> (3 * ((j * 4 + i) & 7))) & 7];
                     has_alpha = alpha < 255;
-                    uint32_t final_color = 0;
-
-                    switch (((block_mem[j + 12]) >> (2 * i)) & 3) {
-                        case 0:
-                            final_color = color_a | (alpha << 24);
-                            break;
-                        case 1:
-                            final_color = color_b | (alpha << 24);
-                            break;
-                        case 2:
-                            final_color = ((85 * (color_b & 0xFF00) + 170 * (color_a & 0xFF00)) >> 8) & 0xFF00
-                                | ((85 * (color_b & 0xFF00FF) + 170 * (color_a & 0xFF00FF)) >> 8) & 0xFF00FF;
-                            break;
-                        case 3:
-                            final_color = ((85 * (color_a & 0xFF00) + 170 * (color_b & 0xFF00)) >> 8) & 0xFF00
-                                | ((85 * (color_a & 0xFF00FF) + 170 * (color_b & 0xFF00FF)) >> 8) & 0xFF00FF;
-                            break;
+                    unsigned code = (codes >> (2 * i)) & 3;
+                    uint32_t final_color = colors[code];
+
+                    if (code < 2) {
+                        final_color |= alpha << 24;
                     }
 
                     final_color |= alpha;
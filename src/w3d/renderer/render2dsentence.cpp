@@ -130,6 +130,11 @@ const FontCharsClass::CharDataStruct *FontCharsClass::Get_Char_Data(unichar_t ch
 #else
         retval = font->Store_GDI_Char(ch);
 #endif
+
+        // Remember glyphs the font can't provide so they aren't rasterized again every time the text is measured.
+        if (retval == nullptr) {
+            retval = font->Store_Missing_Char(ch);
+        }
     }
 
     captainslog_assert(retval->value == ch);
@@ -309,6 +314,22 @@ const FontCharsClass::CharDataStruct *FontCharsClass::Store_GDI_Char(unichar_t c
 #endif
 }
 
+const FontCharsClass::CharDataStruct *FontCharsClass::Store_Missing_Char(unichar_t ch)
+{
+    CharDataStruct *char_data = new CharDataStruct;
+    char_data->value = ch;
+    char_data->width = 0;
+    char_data->buffer = nullptr;
+
+    if (ch < 256) {
+        m_asciiCharArray[ch] = char_data;
+    } else {
+        m_unicodeCharArray[ch - m_firstUnicodeChar] = char_data;
+    }
+
+    return char_data;
+}
+
 void FontCharsClass::Update_Current_Buffer(int char_width)
 {
     bool needs_new_buffer = (m_bufferList.Count() == 0);
@@ -750,6 +771,16 @@ void Render2DSentenceClass::Set_Location(const Vector2 &loc)
     m_location = loc;
 }
 
+void Render2DSentenceClass::Move_Location(const Vector2 &dif)
+{
+    m_location += dif;
+    m_drawExtents += dif;
+
+    for (int i = 0; i < m_renderers.Count(); i++) {
+        m_renderers[i].renderer->Move(dif);
+    }
+}
+
 void Render2DSentenceClass::Set_Base_Location(const Vector2 &loc)
 {
     Vector2 dif = loc - m_baseLocation;
@@ -815,6 +846,7 @@ void Render2DSentenceClass::Draw_Sentence(uint32_t color)
 {
     Render2DClass *curr_renderer = nullptr;
     SurfaceClass *curr_surface = nullptr;
+    SurfaceClass::SurfaceDescription desc;
 
     m_drawExtents.Set(0, 0, 0, 0);
     for (int index = 0; index < m_sentenceData.Count(); index++) {
@@ -846,14 +878,16 @@ void Render2DSentenceClass::Draw_Sentence(uint32_t color)
                     }
                 }
             }
+
+            // Consecutive chunks usually share a surface, only query its size when it changes.
+            if (curr_surface != nullptr) {
+                curr_surface->Get_Description(desc);
+            }
         }
 
         if (curr_surface == nullptr) {
             return;
         }
-
-        SurfaceClass::SurfaceDescription desc;
-        curr_surface->Get_Description(desc);
         RectClass screen_rect = data.screen_rect;
         screen_rect += m_location;
         RectClass uv_rect = data.uv_rect;
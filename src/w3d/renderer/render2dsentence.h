@@ -100,6 +100,7 @@ private:
     void Free_Freetype_Font();
     const CharDataStruct *Store_Freetype_Char(unichar_t ch);
 #endif
+    const CharDataStruct *Store_Missing_Char(unichar_t ch);
     void Update_Current_Buffer(int char_width);
     const CharDataStruct *Get_Char_Data(unichar_t ch);
     void Grow_Unicode_Array(unichar_t ch);
@@ -178,6 +179,7 @@ public:
     void Set_Font(FontCharsClass *font);
     void Set_Location(const Vector2 &loc);
     void Set_Base_Location(const Vector2 &loc);
+    void Move_Location(const Vector2 &dif);
     void Set_Wrapping_Width(float width) { m_wrapWidth = width; }
     void Set_Clipping_Rect(const RectClass &rect)
     {
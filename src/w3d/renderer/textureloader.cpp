@@ -36,6 +36,9 @@ LoaderThreadClass TextureLoader::s_textureLoadThread("Thyme texture Loader threa
 bool TextureLoader::s_textureLoadSuspended;
 FastCriticalSectionClass g_backgroundCritSec;
 FastCriticalSectionClass g_foregroundCritSec;
+
+// Task the loader thread has popped off the background queue and is currently loading, guarded by g_backgroundCritSec.
+static TextureLoadTaskClass *s_backgroundLoadTask;
 #endif
 
 /**
@@ -80,6 +83,7 @@ w3dtexture_t Load_Compressed_Texture(
  */
 void LoaderThreadClass::Thread_Function()
 {
+#ifdef GAME_DLL
     while (m_isRunning) {
         if (!g_backgroundQueue.Empty()) {
             FastCriticalSectionClass::LockClass background_lock(g_backgroundCritSec);
@@ -93,6 +97,34 @@ void LoaderThreadClass::Thread_Function()
 
         Switch_Thread();
     }
+#else
+    while (m_isRunning) {
+        if (g_backgroundQueue.Empty()) {
+            // Nothing queued, sleep rather than spin so the loader doesn't hog a core while idle.
+            Sleep_Ms(1);
+            continue;
+        }
+
+        TextureLoadTaskClass *task;
+
+        {
+            FastCriticalSectionClass::LockClass background_lock(g_backgroundCritSec);
+            task = g_backgroundQueue.Pop_Front();
+            s_backgroundLoadTask = task;
+        }
+
+        if (task) {
+            // The lock isn't held while loading so the main thread can keep queueing work, Request_Foreground_Loading
+            // waits on s_backgroundLoadTask if it wants the task being loaded.
+            task->Load();
+            FastCriticalSectionClass::LockClass background_lock(g_backgroundCritSec);
+            g_foregroundQueue.Push_Back(task);
+            s_backgroundLoadTask = nullptr;
+        }
+
+        Switch_Thread();
+    }
+#endif
 }
 
 /**
@@ -115,8 +147,21 @@ void TextureLoader::Init()
  */
 void TextureLoader::Deinit()
 {
+#ifdef GAME_DLL
     FastCriticalSectionClass::LockClass lock(g_backgroundCritSec);
     s_textureLoadThread.Stop(3000);
+#else
+    // The loader thread takes the background lock to hand back the task it is loading, so it has to be stopped before
+    // the lock is taken or it can only exit through the stop timeout.
+    s_textureLoadThread.Stop(3000);
+    FastCriticalSectionClass::LockClass lock(g_backgroundCritSec);
+
+    // A load that outlived the timeout was cut off, release the task so it doesn't keep its texture referenced.
+    if (s_backgroundLoadTask != nullptr) {
+        s_backgroundLoadTask->Destroy();
+        s_backgroundLoadTask = nullptr;
+    }
+#endif
     ThumbnailManagerClass::Deinit();
     TextureLoadTaskClass::Delete_Free_Pool();
 }
@@ -367,9 +412,29 @@ void TextureLoader::Request_Foreground_Loading(TextureBaseClass *texture)
         }
 
         if (task != nullptr) {
+#ifdef GAME_DLL
             FastCriticalSectionClass::LockClass lock2(g_backgroundCritSec);
             g_foregroundQueue.Remove(task);
             g_backgroundQueue.Remove(task);
+#else
+            bool loading;
+
+            do {
+                {
+                    FastCriticalSectionClass::LockClass lock2(g_backgroundCritSec);
+                    loading = task == s_backgroundLoadTask;
+
+                    if (!loading) {
+                        g_foregroundQueue.Remove(task);
+                        g_backgroundQueue.Remove(task);
+                    }
+                }
+
+                if (loading) {
+                    ThreadClass::Switch_Thread();
+                }
+            } while (loading);
+#endif
         } else {
             task = TextureLoadTaskClass::Create(
                 texture, TextureLoadTaskClass::TASK_LOAD, TextureLoadTaskClass::PRIORITY_FOREGROUND);
@@ -53,6 +53,9 @@ TextureLoadTaskClass::TextureLoadTaskClass() :
 {
     memset(m_lockedSurfacePtr, 0, sizeof(m_lockedSurfacePtr));
     memset(m_lockedSurfacePitch, 0, sizeof(m_lockedSurfacePitch));
+#ifndef GAME_DLL
+    m_compressedLoad = false;
+#endif
 }
 
 /**
@@ -571,6 +574,10 @@ bool TextureLoadTaskClass::Begin_Load()
         res = Begin_Compressed_Load();
     }
 
+#ifndef GAME_DLL
+    m_compressedLoad = res;
+#endif
+
     if (!res) {
         res = Begin_Uncompressed_Load();
     }
@@ -593,7 +600,12 @@ bool TextureLoadTaskClass::Load()
     captainslog_assert(m_texture != 0);
     bool res = false;
 
+#ifdef GAME_DLL
     if (m_texture->m_compressionAllowed) {
+#else
+    // Begin_Load has already failed to find a dds for this texture, don't open and parse it again.
+    if (m_texture->m_compressionAllowed && m_compressedLoad) {
+#endif
         res = Load_Compressed_Mipmap();
     }
 
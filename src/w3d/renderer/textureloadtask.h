@@ -127,4 +127,7 @@ protected:
     TaskType m_type;
     PriorityType m_priority;
     StateType m_loadState;
+#ifndef GAME_DLL
+    bool m_compressedLoad; // Begin_Load found a dds, Load doesn't need to look for one again if it didn't.
+#endif
 };
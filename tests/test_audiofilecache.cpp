@@ -23,6 +23,17 @@
 extern LocalFileSystem *g_theLocalFileSystem;
 
 #ifdef BUILD_WITH_FFMPEG
+class PrefetchAudioEventInfo : public AudioEventInfo
+{
+public:
+    PrefetchAudioEventInfo()
+    {
+        m_eventName = "prefetchevent";
+        m_filename = Utf8String(TESTDATA_PATH) + "/audio/pcm1644m.wav";
+        m_eventType = EVENT_SOUND;
+    }
+};
+
 TEST(audio, ffmpegaudiofilecache)
 {
     g_theLocalFileSystem = new Win32LocalFileSystem;
@@ -56,4 +67,132 @@ TEST(audio, ffmpegaudiofilecache)
 
     delete g_theLocalFileSystem;
 }
+
+TEST(audio, ffmpegaudiofilecache_lru)
+{
+    g_theLocalFileSystem = new Win32LocalFileSystem;
+    Thyme::FFmpegAudioFileCache cache;
+    cache.Set_Max_Size(0xFFFFFF);
+
+    auto first_path = Utf8String(TESTDATA_PATH) + "/audio/pcm1644m.wav";
+    auto second_path = Utf8String(TESTDATA_PATH) + "/audio/ima44s.wav";
+
+    void *first = cache.Open_File(first_path);
+    EXPECT_NE(first, nullptr);
+    auto first_size = cache.Get_Current_Size();
+    void *second = cache.Open_File(second_path);
+    EXPECT_NE(second, nullptr);
+    auto second_size = cache.Get_Current_Size() - first_size;
+
+    cache.Close_File(first);
+    cache.Close_File(second);
+
+    // Using the first file again makes the second one the least recently used.
+    first = cache.Open_File(first_path);
+    cache.Close_File(first);
+
+    EXPECT_EQ(cache.Free_Space(1), second_size);
+    EXPECT_EQ(cache.Get_Current_Size(), first_size);
+
+    delete g_theLocalFileSystem;
+}
+
+TEST(audio, ffmpegaudiofilecache_prefetch)
+{
+    g_theLocalFileSystem = new Win32LocalFileSystem;
+    Thyme::FFmpegAudioFileCache cache;
+    cache.Set_Max_Size(0xFFFFFF);
+
+    auto path = Utf8String(TESTDATA_PATH) + "/audio/pcm1644m.wav";
+
+    EXPECT_EQ(cache.Prefetch_File(path), Thyme::PREFETCH_LOADED);
+    auto size = cache.Get_Current_Size();
+    EXPECT_GT(size, 0u);
+
+    // Opening a prefetched file is a cache hit and prefetched samples can be evicted while unreferenced.
+    void *file = cache.Open_File(path);
+    EXPECT_NE(file, nullptr);
+    EXPECT_EQ(cache.Get_Current_Size(), size);
+    cache.Close_File(file);
+
+    EXPECT_EQ(cache.Free_Space(), size);
+    EXPECT_EQ(cache.Prefetch_File(Utf8String(TESTDATA_PATH) + "/audio/missing.wav"), Thyme::PREFETCH_FAILED);
+
+    // Prefetching never pushes the cache over its limit.
+    cache.Set_Max_Size(size - 1);
+    EXPECT_EQ(cache.Prefetch_File(path), Thyme::PREFETCH_CACHE_FULL);
+    EXPECT_EQ(cache.Get_Current_Size(), 0u);
+
+    delete g_theLocalFileSystem;
+}
+
+TEST(audio, ffmpegaudiofilecache_prefetch_partial)
+{
+    g_theLocalFileSystem = new Win32LocalFileSystem;
+    Thyme::FFmpegAudioFileCache cache;
+    cache.Set_Max_Size(0xFFFFFF);
+
+    auto path = Utf8String(TESTDATA_PATH) + "/audio/pcm1644m.wav";
+    // Same data under another cache key.
+    auto alias_path = Utf8String(TESTDATA_PATH) + "/audio/../audio/pcm1644m.wav";
+    auto open_path = Utf8String(TESTDATA_PATH) + "/audio/ima44s.wav";
+
+    // One unreferenced prefetched sample next to one that is in use.
+    EXPECT_EQ(cache.Prefetch_File(path), Thyme::PREFETCH_LOADED);
+    unsigned prefetched_size = cache.Get_Current_Size();
+    void *open = cache.Open_File(open_path);
+    EXPECT_NE(open, nullptr);
+    unsigned used_size = cache.Get_Current_Size();
+
+    // Evicting every unreferenced sample still wouldn't make room, so nothing is evicted and nothing is added.
+    cache.Set_Max_Size(used_size - prefetched_size / 2);
+    EXPECT_EQ(cache.Prefetch_File(alias_path), Thyme::PREFETCH_CACHE_FULL);
+    EXPECT_EQ(cache.Get_Current_Size(), used_size);
+
+    // With enough unreferenced data the older sample makes way and the cache stays inside its limit.
+    cache.Set_Max_Size(used_size + prefetched_size / 2);
+    EXPECT_EQ(cache.Prefetch_File(alias_path), Thyme::PREFETCH_LOADED);
+    EXPECT_EQ(cache.Get_Current_Size(), used_size);
+    EXPECT_LE(cache.Get_Current_Size(), cache.Get_Max_Size());
+
+    cache.Close_File(open);
+    EXPECT_EQ(cache.Free_Space(), used_size);
+
+    delete g_theLocalFileSystem;
+}
+
+TEST(audio, ffmpegaudiofilecache_prefetch_event)
+{
+    g_theLocalFileSystem = new Win32LocalFileSystem;
+    Thyme::FFmpegAudioFileCache cache;
+    cache.Set_Max_Size(0xFFFFFF);
+
+    auto path = Utf8String(TESTDATA_PATH) + "/audio/pcm1644m.wav";
+    auto other_path = Utf8String(TESTDATA_PATH) + "/audio/ima44s.wav";
+
+    EXPECT_EQ(cache.Prefetch_File(path), Thyme::PREFETCH_LOADED);
+    auto size = cache.Get_Current_Size();
+
+    // An event hitting a prefetched entry takes it over without loading the file again.
+    PrefetchAudioEventInfo info;
+    AudioEventRTS event(Utf8String("prefetchevent"));
+    event.Set_Event_Info_With_Filename(&info);
+    event.Set_Next_Play_Portion(1);
+    void *file = cache.Open_File(&event);
+    EXPECT_NE(file, nullptr);
+    EXPECT_EQ(cache.Get_Current_Size(), size);
+
+    // Referenced entries opened by event or by name have to survive cache pressure from a file without event info.
+    void *named = cache.Open_File(path);
+    EXPECT_EQ(named, file);
+    cache.Set_Max_Size(size);
+    EXPECT_EQ(cache.Open_File(other_path), nullptr);
+    EXPECT_EQ(cache.Get_Current_Size(), size);
+
+    cache.Close_File(named);
+    cache.Close_File(file);
+    EXPECT_EQ(cache.Free_Space(), size);
+
+    delete g_theLocalFileSystem;
+}
 #endif
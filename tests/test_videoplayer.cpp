@@ -18,6 +18,7 @@
 #include <win32localfilesystem.h>
 #ifdef BUILD_WITH_FFMPEG
 #include <ffmpegvideoplayer.h>
+#include <ffmpegvideostream.h>
 #endif
 #ifdef BUILD_WITH_OPENAL
 #include <alaudiomanager.h>
@@ -62,6 +63,21 @@ TEST(video, ffmpegvideoplayer)
         }
     }
 
+    // Every frame went through the decoder and the same size conversion into the software buffer.
+    const Thyme::FFmpegVideoStats &stats = static_cast<Thyme::FFmpegVideoStream *>(stream)->Get_Stats();
+    EXPECT_EQ(stats.frames_rendered, static_cast<unsigned>(count));
+    EXPECT_GE(stats.frames_decoded, stats.frames_rendered);
+    EXPECT_LE(stats.max_decode_time, stats.decode_time);
+    EXPECT_LE(stats.max_convert_time, stats.convert_time);
+
+    // The last frame also has to convert into a buffer of another size and format.
+    VideoBuffer *scaled = new Thyme::SWVideoBuffer(W3DVideoBuffer::TYPE_R5G6B5);
+    ASSERT_TRUE(scaled->Allocate(stream->Width() * 2, stream->Height() * 2));
+    static_cast<Thyme::FFmpegVideoStream *>(stream)->Reset_Stats();
+    stream->Render_Frame(scaled);
+    EXPECT_EQ(static_cast<Thyme::FFmpegVideoStream *>(stream)->Get_Stats().frames_rendered, 1u);
+
+    delete scaled;
     delete buffer;
     delete stream;
     delete g_theAudio;
@@ -0,0 +1,353 @@
+/**
+ * @file
+ *
+ * @author OmniBlade
+ *
+ * @brief Set of tests to validate DXT decoding of dds files
+ *
+ * @copyright Thyme is free software: you can redistribute it and/or
+ *            modify it under the terms of the GNU General Public License
+ *            as published by the Free Software Foundation, either version
+ *            2 of the License, or (at your option) any later version.
+ *            A full copy of the GNU General Public License can be found in
+ *            LICENSE
+ */
+#include <gtest/gtest.h>
+
+#include "always.h"
+#include "colorspace.h"
+#include "ddsfile.h"
+#include "rtsutilsw3d.h"
+#include "vector3.h"
+#include "vector4.h"
+#include "w3dformat.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+const unsigned TEST_SIZE = 32;
+const unsigned TEST_BLOCKS = (TEST_SIZE / 4) * (TEST_SIZE / 4);
+
+uint32_t Reference_Decode_565(const uint8_t *packed)
+{
+    uint16_t value = uint16_t(packed[0]) | (uint16_t(packed[1]) << 8);
+    return ((value & 0x1F) | ((value & 0x7E0) | ((value & 0xF800) << 3) << 2)) << 3;
+}
+
+// The per texel DXT1 and DXT5 decoder DDSFileClass::Get_4x4_Block used before it built a palette per block, kept here
+// so the output of the current decoder can be checked against it bit for bit.
+bool Reference_Get_4x4_Block(uint8_t *dst_ptr,
+    unsigned dst_pitch,
+    WW3DFormat dst_format,
+    WW3DFormat src_format,
+    const uint8_t *block_mem,
+    const Vector3 &color_shift)
+{
+    unsigned dst_bpp = Get_Bytes_Per_Pixel(dst_format);
+    bool adjust_color = false;
+    bool has_alpha = false;
+
+    if (color_shift.X != 0.0f && color_shift.Y != 0.0f && color_shift.Z != 0.0f) {
+        adjust_color = true;
+    }
+
+    switch (src_format) {
+        case WW3D_FORMAT_DXT1: {
+            uint32_t color_a = Reference_Decode_565(block_mem);
+            uint32_t color_b = Reference_Decode_565(block_mem + 2);
+            bool opaque = color_a > color_b;
+
+            if (adjust_color) {
+                Vector4 rgba;
+                Color_To_RGBA(rgba, color_a);
+                Adjust_RGBA(rgba, color_shift);
+                RGBA_To_Color(color_a, rgba);
+                Color_To_RGBA(rgba, color_b);
+                Adjust_RGBA(rgba, color_shift);
+                RGBA_To_Color(color_b, rgba);
+            }
+
+            for (int j = 0; j < 4; ++j) {
+                uint8_t *putp = dst_ptr;
+                dst_ptr += dst_pitch;
+
+                for (int i = 0; i < 4; ++i) {
+                    uint32_t final_color = 0;
+
+                    switch (block_mem[j + 4] & 3) {
+                        case 0:
+                            final_color = color_a;
+                            break;
+                        case 1:
+                            final_color = color_b;
+                            break;
+                        case 2:
+                            if (opaque) {
+                                final_color = ((85 * (color_b & 0xFF00) + 170 * (color_a & 0xFF00)) >> 8) & 0xFF00
+                                    | ((85 * (color_b & 0xFF00FF) + 170 * (color_a & 0xFF00FF)) >> 8) & 0xFF00FF;
+                            } else {
+                                final_color =
+                                    ((127 * (color_a & 0xFF00) + ((uint16_t)(color_b & 0xFF00) << 7)) >> 8) & 0xFF00
+                                    | ((((color_b & 0xFF00FF) << 7) + 0x7F * (color_a & 0xFF00FF)) >> 8) & 0xFF00FF;
+                            }
+                            break;
+                        case 3:
+                            if (opaque) {
+                                final_color = ((85 * (color_a & 0xFF00) + 170 * (color_b & 0xFF00)) >> 8) & 0xFF00
+                                    | ((85 * (color_a & 0xFF00FF) + 170 * (color_b & 0xFF00FF)) >> 8) & 0xFF00FF;
+                            } else {
+                                final_color = 0;
+                            }
+                            break;
+                        default:
+                            break;
+                    }
+
+                    final_color |= 0xFF000000;
+                    Color_To_Format(putp, final_color, dst_format);
+                    putp += dst_bpp;
+                }
+            }
+
+            return !opaque;
+        }
+        case WW3D_FORMAT_DXT5: {
+            unsigned alpha0 = block_mem[0];
+            unsigned alpha1 = block_mem[1];
+            unsigned alphas[8];
+
+            alphas[0] = alpha0;
+            alphas[1] = alpha1;
+
+            if (alpha0 > alpha1) {
+                alphas[2] = (alpha1 + 6 * alpha0 + 3) / 7;
+                alphas[3] = (5 * alpha0 + 2 * alpha1 + 3) / 7;
+                alphas[4] = (3 * alpha1 + 3 + 4 * alpha0) / 7;
+                alphas[5] = (3 * alpha0 + 3 + 4 * alpha1) / 7;
+                alphas[6] = (5 * alpha1 + 2 * alpha0 + 3) / 7;
+                alphas[7] = (alpha0 + 6 * alpha1 + 3) / 7;
+            } else {
+                alphas[2] = (alpha1 + 4 * alpha0 + 2) / 5;
+                alphas[6] = 0;
+                alphas[7] = 255;
+                alphas[3] = (3 * alpha0 + 2 * alpha1 + 2) / 5;
+                alphas[4] = (3 * alpha1 + 2 * alpha0 + 2) / 5;
+                alphas[5] = (alpha0 + 4 * alpha1 + 2) / 5;
+            }
+
+            uint32_t color_a = Reference_Decode_565(block_mem + 8);
+            uint32_t color_b = Reference_Decode_565(block_mem + 10);
+            unsigned alpha_indices[16];
+
+            for (int i = 0; i < 2; ++i) {
+                int value = 0;
+
+                for (int j = 0; j < 3; ++j) {
+                    int byte = block_mem[2 + j];
+                    value |= (byte << 8 * j);
+                }
+
+                for (int j = 0; j < 8; ++j) {
+                    alpha_indices[i * 8 + j] = (value >> 3 * j) & 0x7;
+                }
+            }
+
+            for (int j = 0; j < 4; j++) {
+                uint8_t *putp = dst_ptr;
+                dst_ptr += dst_pitch;
+
+                for (int i = 0; i < 4; i++) {
+                    unsigned alpha = alphas[alpha_indices[j * 4 + i]];
+                    has_alpha = alpha < 255;
+                    uint32_t final_color = 0;
+
+                    switch (((block_mem[j + 12]) >> (2 * i)) & 3) {
+                        case 0:
+                            final_color = color_a | (alpha << 24);
+                            break;
+                        case 1:
+                            final_color = color_b | (alpha << 24);
+                            break;
+                        case 2:
+                            final_color = ((85 * (color_b & 0xFF00) + 170 * (color_a & 0xFF00)) >> 8) & 0xFF00
+                                | ((85 * (color_b & 0xFF00FF) + 170 * (color_a & 0xFF00FF)) >> 8) & 0xFF00FF;
+                            break;
+                        case 3:
+                            final_color = ((85 * (color_a & 0xFF00) + 170 * (color_b & 0xFF00)) >> 8) & 0xFF00
+                                | ((85 * (color_a & 0xFF00FF) + 170 * (color_b & 0xFF00FF)) >> 8) & 0xFF00FF;
+                            break;
+                    }
+
+                    final_color |= alpha;
+                    Color_To_Format(putp, final_color, dst_format);
+                    putp += dst_bpp;
+                }
+            }
+
+            return has_alpha;
+        }
+        default:
+            break;
+    }
+
+    return false;
+}
+
+unsigned Block_Size(WW3DFormat format)
+{
+    return format == WW3D_FORMAT_DXT1 ? 8 : 16;
+}
+
+void Set_Block_565(uint8_t *block, uint16_t color_a, uint16_t color_b)
+{
+    block[0] = color_a & 0xFF;
+    block[1] = color_a >> 8;
+    block[2] = color_b & 0xFF;
+    block[3] = color_b >> 8;
+}
+
+// Fills the first blocks with hand picked edge cases and the rest with random data from a fixed seed.
+std::vector<uint8_t> Make_Blocks(WW3DFormat format, unsigned seed)
+{
+    unsigned block_size = Block_Size(format);
+    std::vector<uint8_t> data(block_size * TEST_BLOCKS);
+    std::mt19937 rng(seed);
+
+    for (auto &byte : data) {
+        byte = static_cast<uint8_t>(rng());
+    }
+
+    // The colour part of a DXT5 block sits after the 8 bytes of alpha.
+    unsigned color_offset = format == WW3D_FORMAT_DXT5 ? 8 : 0;
+    static const uint16_t endpoints[][2] = {
+        { 0xFFFF, 0x0000 }, // c0 > c1, four colour block.
+        { 0x0000, 0xFFFF }, // c0 < c1, three colour block with transparent black in DXT1.
+        { 0x7BEF, 0x7BEF }, // c0 == c1, also three colour in DXT1.
+        { 0xF800, 0x07E0 },
+        { 0x001F, 0xF81F },
+    };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(endpoints); ++i) {
+        for (unsigned code = 0; code < 4; ++code) {
+            uint8_t *block = &data[block_size * (i * 4 + code)];
+            Set_Block_565(block + color_offset, endpoints[i][0], endpoints[i][1]);
+            // Every pixel uses the same code so each palette entry is hit on its own.
+            memset(block + color_offset + 4, code * 0x55, 4);
+        }
+    }
+
+    if (format != WW3D_FORMAT_DXT1) {
+        // Both DXT5 alpha interpolation modes, fully opaque alpha and every alpha index.
+        static const uint8_t alpha_endpoints[][2] = { { 255, 0 }, { 0, 255 }, { 255, 255 }, { 200, 30 }, { 30, 200 } };
+
+        for (unsigned i = 0; i < ARRAY_SIZE(alpha_endpoints); ++i) {
+            uint8_t *block = &data[block_size * (ARRAY_SIZE(endpoints) * 4 + i)];
+            block[0] = alpha_endpoints[i][0];
+            block[1] = alpha_endpoints[i][1];
+            // Indices 0 to 7 in order, packed 3 bits each.
+            block[2] = 0x88;
+            block[3] = 0xC6;
+            block[4] = 0xFA;
+        }
+    }
+
+    return data;
+}
+
+std::string Write_DDS(const char *name, WW3DFormat format, const std::vector<uint8_t> &blocks)
+{
+    std::string path = (std::filesystem::temp_directory_path() / name).string();
+    DDSHeader header = {};
+    header.dwSize = sizeof(DDSHeader);
+    header.dwFlags = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_LINEARSIZE;
+    header.dwHeight = TEST_SIZE;
+    header.dwWidth = TEST_SIZE;
+    header.dwPitchOrLinearSize = static_cast<uint32_t>(blocks.size());
+    header.dwMipMapCount = 1;
+    header.ddspf.dwSize = sizeof(DDSPixelFormat);
+    header.ddspf.dwFlags = DDPF_FOURCC;
+    header.dwCaps = DDSCAPS_TEXTURE;
+
+    switch (format) {
+        case WW3D_FORMAT_DXT1:
+            header.ddspf.dwFourCC = rts::FourCC<'D', 'X', 'T', '1'>::value;
+            break;
+        case WW3D_FORMAT_DXT3:
+            header.ddspf.dwFourCC = rts::FourCC<'D', 'X', 'T', '3'>::value;
+            break;
+        default:
+            header.ddspf.dwFourCC = rts::FourCC<'D', 'X', 'T', '5'>::value;
+            break;
+    }
+
+    uint32_t magic = rts::FourCC<'D', 'D', 'S', ' '>::value;
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(&magic), sizeof(magic));
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(blocks.data()), blocks.size());
+
+    return path;
+}
+
+void Compare_Decoders(const char *name, WW3DFormat format, unsigned seed)
+{
+    std::vector<uint8_t> blocks = Make_Blocks(format, seed);
+    std::string path = Write_DDS(name, format, blocks);
+    DDSFileClass dds(path.c_str(), 0);
+    ASSERT_EQ(dds.Get_Format(), format);
+    ASSERT_TRUE(dds.Load());
+
+    static const Vector3 shifts[] = { Vector3(0.0f, 0.0f, 0.0f), Vector3(0.1f, -0.2f, 0.3f) };
+
+    for (const Vector3 &shift : shifts) {
+        for (WW3DFormat dst_format = WW3D_FORMAT_R8G8B8; dst_format < WW3D_FORMAT_DXT1; ++dst_format) {
+            unsigned dst_bpp = Get_Bytes_Per_Pixel(dst_format);
+
+            if (dst_bpp == 0) {
+                continue;
+            }
+
+            // R8G8B8 is written 4 bytes at a time, pad the rows so the last pixel stays inside the surface.
+            unsigned dst_pitch = TEST_SIZE * dst_bpp + 4;
+            std::vector<uint8_t> expected(dst_pitch * TEST_SIZE, 0xCD);
+            std::vector<uint8_t> actual(expected);
+
+            for (unsigned y = 0; y < TEST_SIZE; y += 4) {
+                for (unsigned x = 0; x < TEST_SIZE; x += 4) {
+                    const uint8_t *block = &blocks[Block_Size(format) * ((x / 4) + (y / 4) * (TEST_SIZE / 4))];
+                    Reference_Get_4x4_Block(
+                        &expected[y * dst_pitch + x * dst_bpp], dst_pitch, dst_format, format, block, shift);
+                }
+            }
+
+            dds.Copy_Level_To_Surface(0, dst_format, TEST_SIZE, TEST_SIZE, actual.data(), dst_pitch, shift);
+            EXPECT_EQ(expected, actual) << name << " decoded to format " << dst_format << " with shift " << shift.X;
+        }
+    }
+
+    std::filesystem::remove(path);
+}
+} // namespace
+
+TEST(w3d_dds, dxt1_matches_reference)
+{
+    Compare_Decoders("thyme_test_dxt1.dds", WW3D_FORMAT_DXT1, 1);
+    Compare_Decoders("thyme_test_dxt1.dds", WW3D_FORMAT_DXT1, 2);
+}
+
+TEST(w3d_dds, dxt3_matches_reference)
+{
+    // Neither decoder handles DXT3, the surface has to be left untouched.
+    Compare_Decoders("thyme_test_dxt3.dds", WW3D_FORMAT_DXT3, 3);
+}
+
+TEST(w3d_dds, dxt5_matches_reference)
+{
+    Compare_Decoders("thyme_test_dxt5.dds", WW3D_FORMAT_DXT5, 4);
+    Compare_Decoders("thyme_test_dxt5.dds", WW3D_FORMAT_DXT5, 5);
+}